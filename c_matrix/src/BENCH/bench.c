@@ -0,0 +1,414 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <limits.h>
+#include <string.h>
+#include <time.h>
+
+#include "../s21_matrix.h"
+
+#define BENCH_MAX_SIZES 32
+#define BENCH_MAX_SAMPLES 1000
+#define BENCH_MIN_SAMPLES 5
+#define BENCH_MAX_RESULTS 1024
+
+typedef struct bench_op {
+  const char *name;
+  int kind;
+  int max_size;
+} bench_op_t;
+
+enum BENCH_KIND {
+  BENCH_SUM,
+  BENCH_SUB,
+  BENCH_MULT_NUMBER,
+  BENCH_EQ,
+  BENCH_TRANSPOSE,
+  BENCH_MULT_MATRIX,
+  BENCH_DETERMINANT,
+  BENCH_INVERSE,
+  BENCH_COMPLEMENTS
+};
+
+typedef struct bench_shape {
+  const char *name;
+  int rows;
+  int inner;
+  int columns;
+} bench_shape_t;
+
+typedef struct bench_result {
+  char op[32];
+  char shape[16];
+  int rows;
+  int inner;
+  int columns;
+  int reps;
+  double median_ns;
+  double p99_ns;
+  double gflops;
+  double gbps;
+} bench_result_t;
+
+typedef struct bench_config {
+  int sizes[BENCH_MAX_SIZES];
+  int size_count;
+  double min_time;
+  const char *only;
+  const char *json;
+  const char *csv;
+  const char *baseline;
+  double threshold;
+  int help;
+} bench_config_t;
+
+static const bench_op_t bench_ops[] = {
+    {"sum_matrix", BENCH_SUM, 4096},
+    {"sub_matrix", BENCH_SUB, 4096},
+    {"mult_number", BENCH_MULT_NUMBER, 4096},
+    {"eq_matrix", BENCH_EQ, 4096},
+    {"transpose", BENCH_TRANSPOSE, 4096},
+    {"mult_matrix", BENCH_MULT_MATRIX, 2048},
+    {"determinant", BENCH_DETERMINANT, 2048},
+    {"inverse_matrix", BENCH_INVERSE, 1024},
+    {"calc_complements", BENCH_COMPLEMENTS, 32},
+};
+
+static bench_result_t bench_results[BENCH_MAX_RESULTS];
+static int bench_result_count = 0;
+
+static double bench_now(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void bench_fill(matrix_t *A, unsigned seed) {
+  unsigned state = seed * 2654435761u + 1u;
+  for (int i = 0; i < A->rows; i++) {
+    for (int j = 0; j < A->columns; j++) {
+      state = state * 1664525u + 1013904223u;
+      A->matrix[i][j] = (double)(state >> 8) / (double)(1u << 24) - 0.5;
+    }
+    if (i < A->columns) A->matrix[i][i] += A->columns;
+  }
+}
+
+static int bench_compare(const void *a, const void *b) {
+  double x = *(const double *)a;
+  double y = *(const double *)b;
+  return (x > y) - (x < y);
+}
+
+static int bench_run_once(int kind, matrix_t *A, matrix_t *B, double *ns) {
+  matrix_t R = {0};
+  double det = 0.0;
+  int err_code = OK;
+  double start = bench_now();
+  if (kind == BENCH_SUM) {
+    err_code = s21_sum_matrix(A, B, &R);
+  } else if (kind == BENCH_SUB) {
+    err_code = s21_sub_matrix(A, B, &R);
+  } else if (kind == BENCH_MULT_NUMBER) {
+    err_code = s21_mult_number(A, 1.5, &R);
+  } else if (kind == BENCH_EQ) {
+    err_code = s21_eq_matrix(A, B) == SUCCESS ? OK : CALCULATION_ERROR;
+  } else if (kind == BENCH_TRANSPOSE) {
+    err_code = s21_transpose(A, &R);
+  } else if (kind == BENCH_MULT_MATRIX) {
+    err_code = s21_mult_matrix(A, B, &R);
+  } else if (kind == BENCH_DETERMINANT) {
+    err_code = s21_determinant(A, &det);
+  } else if (kind == BENCH_INVERSE) {
+    err_code = s21_inverse_matrix(A, &R);
+  } else {
+    err_code = s21_calc_complements(A, &R);
+  }
+  *ns = bench_now() - start;
+  s21_remove_matrix(&R);
+  return err_code;
+}
+
+static void bench_model(int kind, bench_shape_t *s, double *flops,
+                        double *bytes) {
+  double m = s->rows, k = s->inner, n = s->columns;
+  double mn = m * n * sizeof(double);
+  *flops = 0.0;
+  *bytes = 0.0;
+  if (kind == BENCH_SUM || kind == BENCH_SUB) {
+    *flops = m * n;
+    *bytes = 3.0 * mn;
+  } else if (kind == BENCH_MULT_NUMBER) {
+    *flops = m * n;
+    *bytes = 2.0 * mn;
+  } else if (kind == BENCH_EQ) {
+    *flops = m * n;
+    *bytes = 2.0 * mn;
+  } else if (kind == BENCH_TRANSPOSE) {
+    *bytes = 2.0 * mn;
+  } else if (kind == BENCH_MULT_MATRIX) {
+    *flops = 2.0 * m * k * n;
+    *bytes = (m * k + k * n + m * n) * sizeof(double);
+  } else if (kind == BENCH_DETERMINANT) {
+    *flops = 2.0 * n * n * n / 3.0;
+    *bytes = mn;
+  } else if (kind == BENCH_INVERSE) {
+    *flops = 2.0 * n * n * n;
+    *bytes = 2.0 * mn;
+  } else {
+    *bytes = 2.0 * mn;
+  }
+}
+
+static int bench_shapes(const bench_op_t *op, int size, bench_shape_t *out) {
+  int count = 0;
+  out[count++] = (bench_shape_t){"square", size, size, size};
+  if (op->kind == BENCH_MULT_MATRIX && size >= 16) {
+    out[count++] = (bench_shape_t){"tall", size * 4, size / 4, size};
+    out[count++] = (bench_shape_t){"panel", size, size, size / 8};
+  } else if (op->kind <= BENCH_TRANSPOSE && size >= 16) {
+    out[count++] = (bench_shape_t){"tall", size * 4, size / 4, size / 4};
+  }
+  return count;
+}
+
+static int bench_case(const bench_config_t *cfg, const bench_op_t *op,
+                      bench_shape_t *s) {
+  matrix_t A = {0};
+  matrix_t B = {0};
+  int b_rows = op->kind == BENCH_MULT_MATRIX ? s->inner : s->rows;
+  int a_columns = op->kind == BENCH_MULT_MATRIX ? s->inner : s->columns;
+  int err_code = s21_create_matrix(s->rows, a_columns, &A);
+  if (err_code == OK) err_code = s21_create_matrix(b_rows, s->columns, &B);
+  static double samples[BENCH_MAX_SAMPLES];
+  int reps = 0;
+  if (err_code == OK) {
+    bench_fill(&A, 1);
+    bench_fill(&B, op->kind == BENCH_EQ ? 1 : 2);
+    double total = 0.0;
+    err_code = bench_run_once(op->kind, &A, &B, &samples[0]);
+    while (err_code == OK && reps < BENCH_MAX_SAMPLES &&
+           (reps < BENCH_MIN_SAMPLES || total < cfg->min_time * 1e9)) {
+      err_code = bench_run_once(op->kind, &A, &B, &samples[reps]);
+      total += samples[reps++];
+    }
+  }
+  if (err_code == OK && bench_result_count < BENCH_MAX_RESULTS) {
+    qsort(samples, reps, sizeof(double), bench_compare);
+    bench_result_t *r = &bench_results[bench_result_count++];
+    double flops = 0.0, bytes = 0.0;
+    bench_model(op->kind, s, &flops, &bytes);
+    snprintf(r->op, sizeof(r->op), "%s", op->name);
+    snprintf(r->shape, sizeof(r->shape), "%s", s->name);
+    r->rows = s->rows;
+    r->inner = s->inner;
+    r->columns = s->columns;
+    r->reps = reps;
+    r->median_ns = samples[reps / 2];
+    r->p99_ns = samples[(reps * 99) / 100];
+    r->gflops = flops / r->median_ns;
+    r->gbps = bytes / r->median_ns;
+    printf("%-17s %-7s %5d %5d %5d %6d %14.0f %14.0f %9.3f %9.3f\n", r->op,
+           r->shape, r->rows, r->inner, r->columns, r->reps, r->median_ns,
+           r->p99_ns, r->gflops, r->gbps);
+    fflush(stdout);
+  }
+  s21_remove_matrix(&A);
+  s21_remove_matrix(&B);
+  return err_code;
+}
+
+static void bench_write_csv(const char *path) {
+  FILE *f = fopen(path, "w");
+  if (f) {
+    fprintf(f,
+            "op,shape,rows,inner,columns,reps,median_ns,p99_ns,gflops,gbps\n");
+    for (int i = 0; i < bench_result_count; i++) {
+      bench_result_t *r = &bench_results[i];
+      fprintf(f, "%s,%s,%d,%d,%d,%d,%.0f,%.0f,%.4f,%.4f\n", r->op, r->shape,
+              r->rows, r->inner, r->columns, r->reps, r->median_ns, r->p99_ns,
+              r->gflops, r->gbps);
+    }
+    fclose(f);
+  } else {
+    fprintf(stderr, "bench: cannot write %s\n", path);
+  }
+}
+
+static void bench_write_json(const char *path) {
+  FILE *f = fopen(path, "w");
+  if (f) {
+    fprintf(f, "{\n  \"simd_level\": %d,\n  \"threads\": %d,\n",
+            s21_simd_level(), s21_get_num_threads());
+    fprintf(f, "  \"results\": [\n");
+    for (int i = 0; i < bench_result_count; i++) {
+      bench_result_t *r = &bench_results[i];
+      fprintf(f,
+              "    {\"op\": \"%s\", \"shape\": \"%s\", \"rows\": %d, "
+              "\"inner\": %d, \"columns\": %d, \"reps\": %d, "
+              "\"median_ns\": %.0f, \"p99_ns\": %.0f, \"gflops\": %.4f, "
+              "\"gbps\": %.4f}%s\n",
+              r->op, r->shape, r->rows, r->inner, r->columns, r->reps,
+              r->median_ns, r->p99_ns, r->gflops, r->gbps,
+              i + 1 < bench_result_count ? "," : "");
+    }
+    fprintf(f, "  ]\n}\n");
+    fclose(f);
+  } else {
+    fprintf(stderr, "bench: cannot write %s\n", path);
+  }
+}
+
+static int bench_compare_baseline(const char *path, double threshold) {
+  FILE *f = fopen(path, "r");
+  int regressions = 0;
+  if (f) {
+    char line[256];
+    bench_result_t b;
+    while (fgets(line, sizeof(line), f)) {
+      if (sscanf(line, "%31[^,],%15[^,],%d,%d,%d,%d,%lf", b.op, b.shape,
+                 &b.rows, &b.inner, &b.columns, &b.reps, &b.median_ns) != 7) {
+        continue;
+      }
+      for (int i = 0; i < bench_result_count; i++) {
+        bench_result_t *r = &bench_results[i];
+        if (strcmp(r->op, b.op) || strcmp(r->shape, b.shape) ||
+            r->rows != b.rows || r->inner != b.inner ||
+            r->columns != b.columns || b.median_ns <= 0.0) {
+          continue;
+        }
+        double change = r->median_ns / b.median_ns - 1.0;
+        if (change > threshold) {
+          printf("REGRESSION %s %s %dx%dx%d: %.0f ns vs %.0f ns (%+.1f%%)\n",
+                 r->op, r->shape, r->rows, r->inner, r->columns, r->median_ns,
+                 b.median_ns, change * 100.0);
+          regressions++;
+        }
+      }
+    }
+    fclose(f);
+    printf("%d regression(s) against %s\n", regressions, path);
+  } else {
+    fprintf(stderr, "bench: cannot read %s\n", path);
+    regressions = 1;
+  }
+  return regressions;
+}
+
+static int bench_parse_sizes(const char *arg, bench_config_t *cfg) {
+  int err_code = OK;
+  cfg->size_count = 0;
+  while (*arg && err_code == OK) {
+    char *end = NULL;
+    long size = strtol(arg, &end, 10);
+    if (end == arg || size < 1 || cfg->size_count == BENCH_MAX_SIZES) {
+      err_code = INCORRECT_MATRIX;
+    } else {
+      cfg->sizes[cfg->size_count++] = (int)size;
+      arg = *end == ',' ? end + 1 : end;
+    }
+  }
+  return cfg->size_count ? err_code : INCORRECT_MATRIX;
+}
+
+static int bench_parse_int(const char *arg, int *result) {
+  char *end = NULL;
+  long value = strtol(arg, &end, 10);
+  int err_code = INCORRECT_MATRIX;
+  if (end != arg && *end == '\0' && value >= INT_MIN && value <= INT_MAX) {
+    *result = (int)value;
+    err_code = OK;
+  }
+  return err_code;
+}
+
+static void bench_usage(FILE *out) {
+  fprintf(out,
+          "usage: s21_bench [--sizes 16,64,256] [--min-time sec] [--op name]\n"
+          "       [--threads n] [--simd level] [--json file] [--csv file]\n"
+          "       [--baseline file] [--threshold frac] [--help]\n");
+}
+
+static int bench_parse(int argc, char **argv, bench_config_t *cfg) {
+  int err_code = OK;
+  for (int i = 1; i < argc && err_code == OK; i++) {
+    if (!strcmp(argv[i], "--help") || !strcmp(argv[i], "-h")) {
+      cfg->help = 1;
+      continue;
+    }
+    const char *value = i + 1 < argc ? argv[i + 1] : NULL;
+    int number = 0;
+    if (value == NULL) {
+      err_code = INCORRECT_MATRIX;
+    } else if (!strcmp(argv[i], "--sizes")) {
+      err_code = bench_parse_sizes(value, cfg);
+    } else if (!strcmp(argv[i], "--min-time")) {
+      cfg->min_time = atof(value);
+    } else if (!strcmp(argv[i], "--op")) {
+      cfg->only = value;
+    } else if (!strcmp(argv[i], "--threads")) {
+      err_code = bench_parse_int(value, &number);
+      if (err_code == OK &&
+          (number < 1 || s21_set_num_threads(number) != number)) {
+        err_code = INCORRECT_MATRIX;
+      }
+    } else if (!strcmp(argv[i], "--simd")) {
+      err_code = bench_parse_int(value, &number);
+      if (err_code == OK && s21_set_simd_level(number) != number) {
+        err_code = INCORRECT_MATRIX;
+      }
+    } else if (!strcmp(argv[i], "--json")) {
+      cfg->json = value;
+    } else if (!strcmp(argv[i], "--csv")) {
+      cfg->csv = value;
+    } else if (!strcmp(argv[i], "--baseline")) {
+      cfg->baseline = value;
+    } else if (!strcmp(argv[i], "--threshold")) {
+      cfg->threshold = atof(value);
+    } else {
+      err_code = INCORRECT_MATRIX;
+    }
+    i++;
+  }
+  return err_code;
+}
+
+int main(int argc, char **argv) {
+  bench_config_t cfg = {.sizes = {16, 64, 256, 1024},
+                        .size_count = 4,
+                        .min_time = 0.2,
+                        .threshold = 0.10};
+  int err_code = bench_parse(argc, argv, &cfg);
+  if (err_code != OK || cfg.help) {
+    bench_usage(err_code == OK ? stdout : stderr);
+    return err_code == OK ? 0 : 2;
+  }
+  printf("# simd_level %d, threads %d\n", s21_simd_level(),
+         s21_get_num_threads());
+  printf("%-17s %-7s %5s %5s %5s %6s %14s %14s %9s %9s\n", "op", "shape",
+         "rows", "inner", "cols", "reps", "median_ns", "p99_ns", "GFLOP/s",
+         "GB/s");
+  int count = sizeof(bench_ops) / sizeof(bench_ops[0]);
+  for (int o = 0; o < count; o++) {
+    const bench_op_t *op = &bench_ops[o];
+    if (cfg.only && strcmp(cfg.only, op->name)) continue;
+    for (int i = 0; i < cfg.size_count; i++) {
+      if (cfg.sizes[i] > op->max_size) continue;
+      bench_shape_t shapes[3];
+      int n = bench_shapes(op, cfg.sizes[i], shapes);
+      for (int s = 0; s < n; s++) {
+        if (bench_case(&cfg, op, &shapes[s]) != OK) {
+          fprintf(stderr, "bench: %s %s %d failed\n", op->name, shapes[s].name,
+                  cfg.sizes[i]);
+        }
+      }
+    }
+  }
+  if (cfg.csv) bench_write_csv(cfg.csv);
+  if (cfg.json) bench_write_json(cfg.json);
+  int regressions = 0;
+  if (cfg.baseline) {
+    regressions = bench_compare_baseline(cfg.baseline, cfg.threshold);
+  }
+  s21_shutdown_threads();
+  return regressions ? 1 : 0;
+}
@@ -1,4 +1,5 @@
 #include <check.h>
+#include <stdint.h>
 
 #include "../s21_matrix.h"
 
@@ -88,6 +89,25 @@ START_TEST(s21_create_matrix_9) {
 }
 END_TEST
 
+START_TEST(s21_create_matrix_10) {
+  int res = 0;
+  matrix_t A = {0};
+
+  res = s21_create_matrix(5, 3, &A);
+  ck_assert_int_eq(res, OK);
+  ck_assert_int_eq((size_t)A.data % S21_ALIGNMENT, 0);
+  ck_assert_int_eq(A.stride >= A.columns, 1);
+  for (int i = 0; i < A.rows; i++) {
+    ck_assert_int_eq(A.matrix[i] == A.data + i * A.stride, 1);
+    for (int j = 0; j < A.columns; j++) {
+      ck_assert_double_eq(A.matrix[i][j], 0.0);
+    }
+  }
+  s21_remove_matrix(&A);
+  ck_assert_int_eq(A.matrix == NULL && A.data == NULL, 1);
+}
+END_TEST
+
 void matrix_filling(double number, matrix_t *A) {
   for (int i = 0; i < A->rows; i++) {
     for (int j = 0; j < A->columns; number += 1.0, j++)
@@ -1401,6 +1421,117 @@ START_TEST(s21_mult_matrix_7) {
 }
 END_TEST
 
+START_TEST(s21_mult_matrix_8) {
+  int res = 0;
+  matrix_t A = {0};
+  matrix_t B = {0};
+  matrix_t C = {0};
+  matrix_t D = {0};
+
+  s21_create_matrix(131, 277, &A);
+  s21_create_matrix(277, 203, &B);
+  s21_create_matrix(131, 203, &D);
+  for (int i = 0; i < A.rows; i++) {
+    for (int j = 0; j < A.columns; j++) A.matrix[i][j] = (i * 3 + j) % 7 - 3;
+  }
+  for (int i = 0; i < B.rows; i++) {
+    for (int j = 0; j < B.columns; j++) B.matrix[i][j] = (i + j * 5) % 9 - 4;
+  }
+  for (int i = 0; i < D.rows; i++) {
+    for (int j = 0; j < D.columns; j++) {
+      for (int k = 0; k < A.columns; k++) {
+        D.matrix[i][j] += A.matrix[i][k] * B.matrix[k][j];
+      }
+    }
+  }
+
+  res = s21_mult_matrix(&A, &B, &C);
+  ck_assert_int_eq(res, OK);
+  res = s21_eq_matrix(&D, &C);
+
+  s21_remove_matrix(&A);
+  s21_remove_matrix(&B);
+  s21_remove_matrix(&C);
+  s21_remove_matrix(&D);
+
+  ck_assert_int_eq(res, SUCCESS);
+}
+END_TEST
+
+START_TEST(s21_gemm_1) {
+  matrix_t A = {0};
+  matrix_t B = {0};
+  matrix_t C = {0};
+  matrix_t D = {0};
+  matrix_t AB = {0};
+  matrix_t At = {0};
+  matrix_t Bt = {0};
+
+  s21_create_matrix(23, 41, &A);
+  s21_create_matrix(41, 37, &B);
+  matrix_filling(-400.0, &A);
+  matrix_filling(3.0, &B);
+  s21_transpose(&A, &At);
+  s21_transpose(&B, &Bt);
+  s21_mult_matrix(&A, &B, &AB);
+
+  for (int ta = S21_NO_TRANS; ta <= S21_TRANS; ta++) {
+    for (int tb = S21_NO_TRANS; tb <= S21_TRANS; tb++) {
+      s21_create_matrix(23, 37, &C);
+      s21_create_matrix(23, 37, &D);
+      matrix_filling(1.0, &C);
+      for (int i = 0; i < D.rows; i++) {
+        for (int j = 0; j < D.columns; j++) {
+          D.matrix[i][j] = 2.0 * AB.matrix[i][j] - 0.5 * C.matrix[i][j];
+        }
+      }
+      int res = s21_gemm(ta, tb, 2.0, ta ? &At : &A, tb ? &Bt : &B, -0.5, &C);
+      ck_assert_int_eq(res, OK);
+      ck_assert_int_eq(s21_eq_matrix(&C, &D), SUCCESS);
+      s21_remove_matrix(&C);
+      s21_remove_matrix(&D);
+    }
+  }
+
+  s21_create_matrix(23, 37, &C);
+  ck_assert_int_eq(s21_gemm(S21_TRANS, S21_NO_TRANS, 1.0, &A, &B, 0.0, &C),
+                   CALCULATION_ERROR);
+  ck_assert_int_eq(s21_gemm(S21_NO_TRANS, S21_NO_TRANS, 1.0, &A, NULL, 0.0, &C),
+                   INCORRECT_MATRIX);
+  s21_remove_matrix(&C);
+
+  s21_remove_matrix(&A);
+  s21_remove_matrix(&B);
+  s21_remove_matrix(&AB);
+  s21_remove_matrix(&At);
+  s21_remove_matrix(&Bt);
+}
+END_TEST
+
+START_TEST(s21_gemm_2) {
+  matrix_t A = {0};
+  matrix_t B = {0};
+  matrix_t D = {0};
+
+  s21_create_matrix(30, 30, &A);
+  matrix_filling(-2.0, &A);
+  s21_mult_matrix(&A, &A, &B);
+  s21_create_matrix(30, 30, &D);
+  for (int i = 0; i < D.rows; i++) {
+    for (int j = 0; j < D.columns; j++) {
+      D.matrix[i][j] = 0.5 * B.matrix[j][i] + 3.0 * A.matrix[i][j];
+    }
+  }
+
+  ck_assert_int_eq(s21_gemm(S21_TRANS, S21_TRANS, 0.5, &A, &A, 3.0, &A), OK);
+  ck_assert_int_eq(s21_eq_matrix(&A, &D), SUCCESS);
+
+  s21_remove_matrix(&A);
+  s21_remove_matrix(&B);
+  s21_remove_matrix(&D);
+}
+END_TEST
+
 START_TEST(s21_transpose_1) {
   int res = 0;
   matrix_t A = {0};
@@ -1454,6 +1585,85 @@ START_TEST(s21_transpose_3) {
 }
 END_TEST
 
+START_TEST(s21_transpose_4) {
+  matrix_t A = {0};
+  matrix_t T = {0};
+
+  s21_create_matrix(67, 45, &A);
+  matrix_filling(-1000.0, &A);
+  for (int level = S21_SIMD_NONE; level <= S21_SIMD_AVX512; level++) {
+    if (s21_set_simd_level(level) != level) continue;
+    ck_assert_int_eq(s21_transpose(&A, &T), OK);
+    ck_assert_int_eq(T.rows, 45);
+    ck_assert_int_eq(T.columns, 67);
+    for (int i = 0; i < A.rows; i++) {
+      for (int j = 0; j < A.columns; j++) {
+        ck_assert_double_eq(T.matrix[j][i], A.matrix[i][j]);
+      }
+    }
+    s21_remove_matrix(&T);
+  }
+  s21_set_simd_level(-1);
+  s21_remove_matrix(&A);
+}
+END_TEST
+
+START_TEST(s21_transpose_5) {
+  matrix_t A = {0};
+  matrix_t B = {0};
+  matrix_t T = {0};
+
+  s21_create_matrix(70, 70, &A);
+  matrix_filling(0.0, &A);
+  s21_transpose(&A, &T);
+  ck_assert_int_eq(s21_transpose_inplace(&A), OK);
+  ck_assert_int_eq(s21_eq_matrix(&A, &T), SUCCESS);
+  s21_remove_matrix(&T);
+
+  s21_create_matrix(37, 53, &B);
+  matrix_filling(5.0, &B);
+  s21_transpose(&B, &T);
+  ck_assert_int_eq(s21_transpose_inplace(&B), OK);
+  ck_assert_int_eq(B.rows, 53);
+  ck_assert_int_eq(B.columns, 37);
+  ck_assert_int_eq(B.stride % (S21_ALIGNMENT / sizeof(double)), 0);
+  for (int i = 0; i < B.rows; i++) {
+    ck_assert_int_eq((uintptr_t)B.matrix[i] % S21_ALIGNMENT, 0);
+    ck_assert_ptr_eq(B.matrix[i], B.data + (size_t)i * B.stride);
+  }
+  ck_assert_int_eq(s21_eq_matrix(&B, &T), SUCCESS);
+  ck_assert_int_eq(s21_transpose_inplace(&B), OK);
+  ck_assert_double_eq(B.matrix[36][52], 5.0 + 37 * 53 - 1);
+  s21_remove_matrix(&B);
+  s21_remove_matrix(&T);
+
+  s21_create_matrix(16, 40, &B);
+  matrix_filling(1.0, &B);
+  s21_transpose(&B, &T);
+  double *data = B.data;
+  ck_assert_int_eq(s21_transpose_inplace(&B), OK);
+  ck_assert_ptr_eq(B.data, data);
+  ck_assert_int_eq(B.stride, 16);
+  ck_assert_int_eq(s21_eq_matrix(&B, &T), SUCCESS);
+
+  s21_remove_matrix(&A);
+  s21_remove_matrix(&B);
+  s21_remove_matrix(&T);
+}
+END_TEST
+
+START_TEST(s21_transpose_6) {
+  arena_t arena = {0};
+  matrix_t A = {0};
+
+  s21_create_arena(s21_matrix_bytes(2, 3), &arena);
+  s21_create_matrix_arena(2, 3, &arena, &A);
+  ck_assert_int_eq(s21_transpose_inplace(&A), INCORRECT_MATRIX);
+  ck_assert_int_eq(s21_transpose_inplace(NULL), INCORRECT_MATRIX);
+  s21_remove_arena(&arena);
+}
+END_TEST
+
 START_TEST(s21_determinant_1) {
   int res = 0;
   double determinant = 0.0;
@@ -1569,6 +1779,57 @@ START_TEST(s21_determinant_7) {
 }
 END_TEST
 
+START_TEST(s21_determinant_8) {
+  int res = 0;
+  double determinant = 0.0;
+  matrix_t A = {0};
+
+  s21_create_matrix(40, 40, &A);
+  for (int i = 0; i < A.rows; i++) {
+    for (int j = 0; j < A.columns; j++) A.matrix[i][j] = (i == j) ? 3.0 : 1.0;
+  }
+
+  res = s21_determinant(&A, &determinant);
+  ck_assert_int_eq(res, OK);
+  ck_assert_double_eq_tol(determinant / pow(2.0, 39), 42.0, 1e-9);
+  s21_remove_matrix(&A);
+}
+END_TEST
+
+START_TEST(s21_determinant_9) {
+  int res = 0;
+  double determinant = 0.0;
+  double exact = 0.0;
+  matrix_t A = {0};
+
+  s21_create_matrix(7, 7, &A);
+  for (int i = 0; i < A.rows; i++) {
+    for (int j = 0; j < A.columns; j++) {
+      A.matrix[i][j] = ((i * 7 + j * 3) % 11) - 5.0;
+    }
+  }
+
+  res = s21_determinant(&A, &determinant);
+  ck_assert_int_eq(res, OK);
+  res = s21_determinant_exact(&A, &exact);
+  ck_assert_int_eq(res, OK);
+  ck_assert_double_eq_tol(determinant, exact, 1e-7 * fabs(exact));
+  s21_remove_matrix(&A);
+}
+END_TEST
+
+START_TEST(s21_determinant_10) {
+  int res = 0;
+  double determinant = 0.0;
+  matrix_t A = {0};
+
+  s21_create_matrix(11, 11, &A);
+  res = s21_determinant_exact(&A, &determinant);
+  ck_assert_int_eq(res, CALCULATION_ERROR);
+  s21_remove_matrix(&A);
+}
+END_TEST
+
 START_TEST(s21_calc_complements_1) {
   int res = 0;
   matrix_t A = {0};
@@ -1908,6 +2169,1890 @@ START_TEST(s21_inverse_matrix_6) {
 }
 END_TEST
 
+START_TEST(s21_inverse_matrix_7) {
+  int res = 0;
+  matrix_t A = {0};
+  matrix_t C = {0};
+  matrix_t P = {0};
+  matrix_t E = {0};
+
+  s21_create_matrix(60, 60, &A);
+  for (int i = 0; i < A.rows; i++) {
+    for (int j = 0; j < A.columns; j++) {
+      A.matrix[i][j] = ((i * 13 + j * 7) % 17) - 8.0 + (i == j ? 30.0 : 0.0);
+    }
+  }
+  s21_create_matrix(60, 60, &E);
+  for (int i = 0; i < E.rows; i++) E.matrix[i][i] = 1.0;
+
+  res = s21_inverse_matrix(&A, &C);
+  ck_assert_int_eq(res, OK);
+  s21_mult_matrix(&A, &C, &P);
+  res = s21_eq_matrix(&P, &E);
+  ck_assert_int_eq(res, SUCCESS);
+
+  s21_remove_matrix(&A);
+  s21_remove_matrix(&C);
+  s21_remove_matrix(&P);
+  s21_remove_matrix(&E);
+}
+END_TEST
+
+START_TEST(s21_inverse_matrix_8) {
+  int res = 0;
+  matrix_t A = {0};
+  matrix_t C = {0};
+
+  s21_create_matrix(9, 9, &A);
+  matrix_filling(1.0, &A);
+
+  res = s21_inverse_matrix(&A, &C);
+  ck_assert_int_eq(res, CALCULATION_ERROR);
+  s21_remove_matrix(&A);
+}
+END_TEST
+
+START_TEST(s21_inverse_matrix_9) {
+  matrix_t A = {0};
+  matrix_t C = {0};
+  matrix_t P = {0};
+  matrix_t E = {0};
+
+  s21_create_matrix(5, 5, &A);
+  s21_create_matrix(5, 5, &E);
+  for (int i = 0; i < 5; i++) {
+    A.matrix[i][i] = 1.0;
+    E.matrix[i][i] = 1.0;
+  }
+  A.matrix[0][4] = 1e15;
+  double det = 0;
+  ck_assert_int_eq(s21_determinant(&A, &det), OK);
+  ck_assert_double_eq(det, 1.0);
+  ck_assert_int_eq(s21_inverse_matrix(&A, &C), OK);
+  ck_assert_double_eq(C.matrix[0][4], -1e15);
+  s21_mult_matrix(&A, &C, &P);
+  ck_assert_int_eq(s21_eq_matrix(&P, &E), SUCCESS);
+
+  s21_remove_matrix(&A);
+  s21_remove_matrix(&C);
+  s21_remove_matrix(&P);
+  s21_remove_matrix(&E);
+}
+END_TEST
+
+START_TEST(s21_simd_level_1) {
+  matrix_t A = {0};
+  matrix_t B = {0};
+  matrix_t C = {0};
+  matrix_t D = {0};
+
+  s21_create_matrix(7, 13, &A);
+  s21_create_matrix(7, 13, &B);
+  s21_create_matrix(7, 13, &D);
+  matrix_filling(-20.0, &A);
+  matrix_filling(3.5, &B);
+
+  for (int level = S21_SIMD_NONE; level <= S21_SIMD_AVX512; level++) {
+    if (s21_set_simd_level(level) != level) continue;
+
+    s21_sum_matrix(&A, &B, &C);
+    for (int i = 0; i < D.rows; i++) {
+      for (int j = 0; j < D.columns; j++) {
+        D.matrix[i][j] = A.matrix[i][j] + B.matrix[i][j];
+      }
+    }
+    ck_assert_int_eq(s21_eq_matrix(&C, &D), SUCCESS);
+    s21_remove_matrix(&C);
+
+    s21_sub_matrix(&A, &B, &C);
+    for (int i = 0; i < D.rows; i++) {
+      for (int j = 0; j < D.columns; j++) {
+        D.matrix[i][j] = A.matrix[i][j] - B.matrix[i][j];
+      }
+    }
+    ck_assert_int_eq(s21_eq_matrix(&C, &D), SUCCESS);
+    s21_remove_matrix(&C);
+
+    s21_mult_number(&A, -0.25, &C);
+    for (int i = 0; i < D.rows; i++) {
+      for (int j = 0; j < D.columns; j++) D.matrix[i][j] = A.matrix[i][j] / -4;
+    }
+    ck_assert_int_eq(s21_eq_matrix(&C, &D), SUCCESS);
+    C.matrix[6][12] += 1e-6;
+    ck_assert_int_eq(s21_eq_matrix(&C, &D), FAILURE);
+    C.matrix[6][12] -= 1e-6;
+    C.matrix[3][1] -= 1e-6;
+    ck_assert_int_eq(s21_eq_matrix(&C, &D), FAILURE);
+    s21_remove_matrix(&C);
+  }
+  s21_set_simd_level(-1);
+
+  s21_remove_matrix(&A);
+  s21_remove_matrix(&B);
+  s21_remove_matrix(&D);
+}
+END_TEST
+
+START_TEST(s21_simd_level_2) {
+  matrix_t A = {0};
+  matrix_t B = {0};
+  matrix_t C = {0};
+  matrix_t D = {0};
+
+  s21_create_matrix(45, 61, &A);
+  s21_create_matrix(61, 23, &B);
+  s21_create_matrix(45, 23, &D);
+  matrix_filling(-30.0, &A);
+  matrix_filling(0.5, &B);
+  for (int i = 0; i < D.rows; i++) {
+    for (int j = 0; j < D.columns; j++) {
+      for (int k = 0; k < A.columns; k++) {
+        D.matrix[i][j] += A.matrix[i][k] * B.matrix[k][j];
+      }
+    }
+  }
+
+  for (int level = S21_SIMD_NONE; level <= S21_SIMD_AVX512; level++) {
+    if (s21_set_simd_level(level) != level) continue;
+    s21_mult_matrix(&A, &B, &C);
+    ck_assert_int_eq(s21_eq_matrix(&C, &D), SUCCESS);
+    s21_remove_matrix(&C);
+  }
+  ck_assert_int_eq(s21_set_simd_level(-1), s21_simd_level());
+
+  s21_remove_matrix(&A);
+  s21_remove_matrix(&B);
+  s21_remove_matrix(&D);
+}
+END_TEST
+
+START_TEST(s21_threads_1) {
+  matrix_t A = {0};
+  matrix_t B = {0};
+  matrix_t C = {0};
+  matrix_t D = {0};
+
+  s21_create_matrix(150, 170, &A);
+  s21_create_matrix(170, 190, &B);
+  matrix_filling(-100.0, &A);
+  matrix_filling(0.25, &B);
+
+  ck_assert_int_eq(s21_set_num_threads(1), 1);
+  s21_mult_matrix(&A, &B, &D);
+
+  ck_assert_int_eq(s21_set_num_threads(4), 4);
+  ck_assert_int_eq(s21_get_num_threads(), 4);
+  s21_set_parallel_threshold(16);
+  for (int round = 0; round < 3; round++) {
+    s21_mult_matrix(&A, &B, &C);
+    ck_assert_int_eq(s21_eq_matrix(&C, &D), SUCCESS);
+    s21_remove_matrix(&C);
+    if (round == 1) s21_shutdown_threads();
+  }
+  s21_shutdown_threads();
+  s21_set_parallel_threshold(0);
+  ck_assert_int_eq(s21_set_num_threads(0) >= 1, 1);
+
+  s21_remove_matrix(&A);
+  s21_remove_matrix(&B);
+  s21_remove_matrix(&D);
+}
+END_TEST
+
+START_TEST(s21_into_1) {
+  matrix_t A = {0};
+  matrix_t B = {0};
+  matrix_t C = {0};
+  matrix_t D = {0};
+
+  s21_create_matrix(5, 9, &A);
+  s21_create_matrix(5, 9, &B);
+  s21_create_matrix(5, 9, &C);
+  matrix_filling(1.0, &A);
+  matrix_filling(-7.0, &B);
+
+  ck_assert_int_eq(s21_sum_matrix_into(&A, &B, &C), OK);
+  s21_sum_matrix(&A, &B, &D);
+  ck_assert_int_eq(s21_eq_matrix(&C, &D), SUCCESS);
+
+  ck_assert_int_eq(s21_sum_matrix_into(&A, &B, &A), OK);
+  ck_assert_int_eq(s21_eq_matrix(&A, &D), SUCCESS);
+  ck_assert_int_eq(s21_sub_matrix_into(&A, &B, &A), OK);
+  ck_assert_int_eq(s21_mult_number_into(&A, 2.0, &A), OK);
+  ck_assert_int_eq(s21_sub_matrix_into(&A, &A, &C), OK);
+  ck_assert_int_eq(s21_mult_number_into(&C, 3.0, &D), OK);
+  ck_assert_int_eq(C.matrix[4][8], 0.0);
+  ck_assert_double_eq(A.matrix[4][8], 90.0);
+
+  ck_assert_int_eq(s21_transpose_into(&A, &C), CALCULATION_ERROR);
+  ck_assert_int_eq(s21_sum_matrix_into(&A, &B, NULL), INCORRECT_MATRIX);
+
+  s21_remove_matrix(&A);
+  s21_remove_matrix(&B);
+  s21_remove_matrix(&C);
+  s21_remove_matrix(&D);
+}
+END_TEST
+
+START_TEST(s21_into_2) {
+  matrix_t A = {0};
+  matrix_t B = {0};
+  matrix_t C = {0};
+  matrix_t T = {0};
+
+  s21_create_matrix(40, 40, &A);
+  s21_create_matrix(40, 40, &B);
+  for (int i = 0; i < A.rows; i++) {
+    for (int j = 0; j < A.columns; j++) {
+      A.matrix[i][j] = (i * 5 + j * 3) % 13 - 6 + (i == j ? 20.0 : 0.0);
+      B.matrix[i][j] = (i + j) % 4 + (i == j ? 9.0 : 0.0);
+    }
+  }
+
+  s21_mult_matrix(&A, &B, &C);
+  ck_assert_int_eq(s21_mult_matrix_into(&A, &B, &A), OK);
+  ck_assert_int_eq(s21_eq_matrix(&A, &C), SUCCESS);
+
+  s21_transpose(&A, &T);
+  ck_assert_int_eq(s21_transpose_into(&A, &A), OK);
+  ck_assert_int_eq(s21_eq_matrix(&A, &T), SUCCESS);
+
+  s21_remove_matrix(&C);
+  s21_inverse_matrix(&T, &C);
+  ck_assert_int_eq(s21_inverse_matrix_into(&T, &T), OK);
+  ck_assert_int_eq(s21_eq_matrix(&T, &C), SUCCESS);
+
+  s21_remove_matrix(&A);
+  s21_remove_matrix(&B);
+  s21_remove_matrix(&C);
+  s21_remove_matrix(&T);
+}
+END_TEST
+
+START_TEST(s21_into_3) {
+  matrix_t A = {0};
+  matrix_t C = {0};
+  matrix_t D = {0};
+
+  s21_create_matrix(3, 3, &A);
+  s21_create_matrix(3, 3, &C);
+  A.matrix[0][0] = 1.0;
+  A.matrix[0][1] = 2.0;
+  A.matrix[0][2] = 3.0;
+  A.matrix[1][0] = 0.0;
+  A.matrix[1][1] = 4.0;
+  A.matrix[1][2] = 2.0;
+  A.matrix[2][0] = 5.0;
+  A.matrix[2][1] = 2.0;
+  A.matrix[2][2] = 1.0;
+
+  ck_assert_int_eq(s21_calc_complements_into(&A, &C), OK);
+  s21_calc_complements(&A, &D);
+  ck_assert_int_eq(s21_eq_matrix(&C, &D), SUCCESS);
+  ck_assert_double_eq(C.matrix[0][1], 10.0);
+  ck_assert_int_eq(s21_calc_complements_into(&A, &A), OK);
+  ck_assert_int_eq(s21_eq_matrix(&A, &D), SUCCESS);
+
+  s21_remove_matrix(&A);
+  s21_remove_matrix(&C);
+  s21_remove_matrix(&D);
+}
+END_TEST
+
+START_TEST(s21_arena_1) {
+  arena_t arena = {0};
+  matrix_t A = {0};
+  matrix_t B = {0};
+
+  ck_assert_int_eq(s21_create_arena(0, &arena), INCORRECT_MATRIX);
+  ck_assert_int_eq(s21_create_arena(s21_matrix_bytes(4, 4), &arena), OK);
+  ck_assert_int_eq(s21_create_matrix_arena(4, 4, &arena, &A), OK);
+  ck_assert_int_eq(s21_create_matrix_arena(4, 4, &arena, &B),
+                   INCORRECT_MATRIX);
+  ck_assert_int_eq((size_t)A.data % S21_ALIGNMENT, 0);
+  matrix_filling(1.0, &A);
+  ck_assert_double_eq(A.matrix[3][3], 16.0);
+  s21_remove_matrix(&A);
+  ck_assert_int_eq(A.matrix == NULL, 1);
+
+  s21_arena_reset(&arena);
+  ck_assert_int_eq(arena.used, 0);
+  ck_assert_int_eq(s21_create_matrix_arena(4, 4, &arena, &A), OK);
+  ck_assert_double_eq(A.matrix[3][3], 0.0);
+  s21_remove_arena(&arena);
+}
+END_TEST
+
+START_TEST(s21_arena_2) {
+  arena_t arena = {0};
+  matrix_t A = {0};
+  matrix_t B = {0};
+  matrix_t C = {0};
+  matrix_t D = {0};
+  double det = 0;
+  double exact = 0;
+
+  s21_create_matrix(9, 9, &A);
+  for (int i = 0; i < A.rows; i++) {
+    for (int j = 0; j < A.columns; j++) {
+      A.matrix[i][j] = (i * 4 + j * 7) % 10 - 4.5 + (i == j ? 6.0 : 0.0);
+    }
+  }
+  s21_calc_complements(&A, &D);
+
+  ck_assert_int_eq(s21_create_arena(1 << 20, &arena), OK);
+  ck_assert_int_eq(s21_bind_arena(&arena) == NULL, 1);
+  size_t mark = s21_arena_mark(&arena);
+  ck_assert_int_eq(s21_create_matrix_arena(9, 9, &arena, &B), OK);
+  ck_assert_int_eq(s21_create_matrix_arena(9, 9, &arena, &C), OK);
+  size_t used = arena.used;
+
+  ck_assert_int_eq(s21_determinant(&A, &det), OK);
+  ck_assert_int_eq(s21_determinant_exact(&A, &exact), OK);
+  ck_assert_double_eq_tol(det, exact, 1e-9 * fabs(exact));
+  ck_assert_int_eq(s21_inverse_matrix_into(&A, &B), OK);
+  ck_assert_int_eq(s21_calc_complements_into(&A, &C), OK);
+  ck_assert_int_eq(s21_eq_matrix(&C, &D), SUCCESS);
+  ck_assert_int_eq(s21_mult_matrix_into(&A, &B, &B), OK);
+  ck_assert_double_eq_tol(B.matrix[4][4], 1.0, 1e-9);
+  ck_assert_double_eq_tol(B.matrix[4][5], 0.0, 1e-9);
+  ck_assert_int_eq(arena.used, used);
+
+  s21_arena_release(&arena, mark);
+  ck_assert_int_eq(arena.used, mark);
+  ck_assert_int_eq(s21_bind_arena(NULL) == &arena, 1);
+  s21_remove_arena(&arena);
+  s21_remove_matrix(&A);
+  s21_remove_matrix(&D);
+}
+END_TEST
+
+static void sparse_filling(matrix_t *A) {
+  for (int i = 0; i < A->rows; i++) {
+    for (int j = 0; j < A->columns; j++) {
+      A->matrix[i][j] = (i * 7 + j * 3) % 5 == 0 ? i - 2.0 * j + 0.5 : 0.0;
+    }
+  }
+}
+
+START_TEST(s21_map_matrix_1) {
+  const char *path = "s21_map_test.bin";
+  matrix_t A = {0};
+  matrix_t M = {0};
+
+  s21_create_matrix(37, 21, &A);
+  matrix_filling(-100.0, &A);
+  ck_assert_int_eq(s21_save_matrix(&A, path), OK);
+  ck_assert_int_eq(s21_map_matrix(path, S21_MAP_READONLY | S21_MAP_VERIFY, &M),
+                   OK);
+  ck_assert_int_eq(M.rows, 37);
+  ck_assert_int_eq(M.columns, 21);
+  ck_assert_int_eq((uintptr_t)M.data % S21_ALIGNMENT, 0);
+  ck_assert_int_eq(s21_eq_matrix(&A, &M), SUCCESS);
+  ck_assert_int_eq(s21_transpose_inplace(&M), INCORRECT_MATRIX);
+  s21_remove_matrix(&M);
+
+  ck_assert_int_eq(s21_map_matrix(path, S21_MAP_PRIVATE, &M), OK);
+  M.matrix[5][7] = 12345.0;
+  s21_remove_matrix(&M);
+  ck_assert_int_eq(s21_map_matrix(path, S21_MAP_READONLY, &M), OK);
+  ck_assert_double_eq(M.matrix[5][7], A.matrix[5][7]);
+  s21_remove_matrix(&M);
+
+  FILE *file = fopen(path, "r+b");
+  fseek(file, 4096 + 8 * 100, SEEK_SET);
+  fputc(0x7f, file);
+  fclose(file);
+  ck_assert_int_eq(s21_map_matrix(path, S21_MAP_VERIFY, &M),
+                   CALCULATION_ERROR);
+  ck_assert_ptr_null(M.matrix);
+  ck_assert_int_eq(s21_map_matrix(path, S21_MAP_READONLY, &M), OK);
+  s21_remove_matrix(&M);
+
+  file = fopen(path, "wb");
+  fputs("not a matrix", file);
+  fclose(file);
+  ck_assert_int_eq(s21_map_matrix(path, S21_MAP_READONLY, &M),
+                   CALCULATION_ERROR);
+  remove(path);
+  ck_assert_int_eq(s21_map_matrix(path, S21_MAP_READONLY, &M),
+                   CALCULATION_ERROR);
+  ck_assert_int_eq(s21_save_matrix(&M, path), INCORRECT_MATRIX);
+  s21_remove_matrix(&A);
+}
+END_TEST
+
+START_TEST(s21_map_matrix_2) {
+  const char *path = "s21_map_readonly.bin";
+  matrix_t A = {0};
+  matrix_t M = {0};
+  matrix_t R = {0};
+  matrix_t V = {0};
+  batch_t B = {0};
+  factor_t F = {0};
+
+  s21_create_matrix(6, 6, &A);
+  matrix_filling(2.0, &A);
+  for (int i = 0; i < 6; i++) A.matrix[i][i] += 100.0;
+  s21_save_matrix(&A, path);
+  ck_assert_int_eq(s21_map_matrix(path, S21_MAP_READONLY, &M), OK);
+  ck_assert_int_eq(M.flags & S21_READONLY, S21_READONLY);
+  ck_assert_int_eq(s21_sum_matrix_into(&A, &A, &M), INCORRECT_MATRIX);
+  ck_assert_int_eq(s21_sub_matrix_into(&A, &A, &M), INCORRECT_MATRIX);
+  ck_assert_int_eq(s21_mult_number_into(&A, 2.0, &M), INCORRECT_MATRIX);
+  ck_assert_int_eq(s21_mult_matrix_into(&A, &A, &M), INCORRECT_MATRIX);
+  ck_assert_int_eq(s21_gemm(S21_TRANS, S21_NO_TRANS, 1.0, &A, &A, 1.0, &M),
+                   INCORRECT_MATRIX);
+  ck_assert_int_eq(s21_transpose_into(&A, &M), INCORRECT_MATRIX);
+  ck_assert_int_eq(s21_calc_complements_into(&A, &M), INCORRECT_MATRIX);
+  ck_assert_int_eq(s21_inverse_matrix_into(&A, &M), INCORRECT_MATRIX);
+  ck_assert_int_eq(s21_transpose_inplace(&M), INCORRECT_MATRIX);
+  s21_create_batch(6, 6, 1, &B);
+  ck_assert_int_eq(s21_batch_get(&B, 0, &M), INCORRECT_MATRIX);
+  s21_remove_batch(&B);
+
+  ck_assert_int_eq(s21_create_view(&M, 1, 1, 3, 3, &V), OK);
+  ck_assert_int_eq(s21_transpose_inplace(&V), INCORRECT_MATRIX);
+  s21_remove_matrix(&V);
+  for (int j = 0; j < 6; j++) {
+    ck_assert_int_eq(s21_create_minor_view(&M, 2, j, &V), OK);
+    ck_assert_int_eq(V.flags & S21_READONLY, S21_READONLY);
+    ck_assert_int_eq(s21_mult_number_into(&V, 2.0, &V), INCORRECT_MATRIX);
+    ck_assert_int_eq(s21_transpose_inplace(&V), INCORRECT_MATRIX);
+    ck_assert_double_eq(V.matrix[2][0], A.matrix[3][j == 0]);
+    s21_remove_matrix(&V);
+  }
+  ck_assert_int_eq(s21_transpose_lazy(&M, &V), OK);
+  ck_assert_int_eq(s21_mult_number_into(&A, 2.0, &V), INCORRECT_MATRIX);
+  ck_assert_int_eq(s21_eq_matrix(&A, &M), SUCCESS);
+
+  ck_assert_int_eq(s21_mult_number(&M, 2.0, &R), OK);
+  ck_assert_double_eq(R.matrix[0][0], 2.0 * A.matrix[0][0]);
+  ck_assert_int_eq(s21_factorize(&M, &F), OK);
+  ck_assert_int_eq(s21_factor_inverse(&F, &V), OK);
+  s21_remove_matrix(&V);
+  s21_remove_factor(&F);
+  s21_remove_matrix(&M);
+
+  ck_assert_int_eq(s21_map_matrix(path, S21_MAP_PRIVATE, &M), OK);
+  ck_assert_int_eq(M.flags & S21_READONLY, 0);
+  ck_assert_int_eq(s21_mult_number_into(&A, 2.0, &M), OK);
+  ck_assert_int_eq(s21_transpose_inplace(&M), OK);
+  ck_assert_int_eq(s21_eq_matrix(&R, &M), FAILURE);
+  s21_remove_matrix(&M);
+
+  remove(path);
+  s21_remove_matrix(&A);
+  s21_remove_matrix(&R);
+}
+END_TEST
+
+START_TEST(s21_mult_matrix_file_1) {
+  matrix_t A = {0};
+  matrix_t B = {0};
+  matrix_t C = {0};
+  matrix_t M = {0};
+
+  s21_create_matrix(70, 45, &A);
+  s21_create_matrix(45, 53, &B);
+  matrix_filling(-1500.0, &A);
+  matrix_filling(7.0, &B);
+  s21_mult_matrix(&A, &B, &C);
+  s21_save_matrix(&A, "s21_ooc_a.bin");
+  s21_save_matrix(&B, "s21_ooc_b.bin");
+
+  ck_assert_int_eq(s21_mult_matrix_file("s21_ooc_a.bin", "s21_ooc_b.bin",
+                                        "s21_ooc_c.bin", 20000),
+                   OK);
+  ck_assert_int_eq(s21_map_matrix("s21_ooc_c.bin", S21_MAP_VERIFY, &M), OK);
+  ck_assert_int_eq(s21_eq_matrix(&C, &M), SUCCESS);
+  s21_remove_matrix(&M);
+
+  ck_assert_int_eq(s21_mult_matrix_file("s21_ooc_a.bin", "s21_ooc_b.bin",
+                                        "s21_ooc_c.bin", 1 << 24),
+                   OK);
+  ck_assert_int_eq(s21_map_matrix("s21_ooc_c.bin", S21_MAP_VERIFY, &M), OK);
+  ck_assert_int_eq(s21_eq_matrix(&C, &M), SUCCESS);
+  s21_remove_matrix(&M);
+
+  ck_assert_int_eq(s21_mult_matrix_file("s21_ooc_a.bin", "s21_ooc_b.bin",
+                                        "s21_ooc_c.bin", 100),
+                   CALCULATION_ERROR);
+  ck_assert_int_eq(s21_mult_matrix_file("s21_ooc_a.bin", "s21_ooc_a.bin",
+                                        "s21_ooc_c.bin", 20000),
+                   CALCULATION_ERROR);
+  ck_assert_int_eq(s21_mult_matrix_file("s21_ooc_a.bin", "s21_missing.bin",
+                                        "s21_ooc_c.bin", 20000),
+                   INCORRECT_MATRIX);
+  remove("s21_ooc_a.bin");
+  remove("s21_ooc_b.bin");
+  remove("s21_ooc_c.bin");
+  s21_remove_matrix(&A);
+  s21_remove_matrix(&B);
+  s21_remove_matrix(&C);
+}
+END_TEST
+
+START_TEST(s21_view_1) {
+  matrix_t A = {0};
+  matrix_t V1 = {0};
+  matrix_t V2 = {0};
+  matrix_t V3 = {0};
+  matrix_t X = {0};
+  matrix_t Y = {0};
+  matrix_t Z = {0};
+
+  s21_create_matrix(12, 12, &A);
+  matrix_filling(-3.0, &A);
+  ck_assert_int_eq(s21_create_view(&A, 0, 0, 4, 4, &V1), OK);
+  ck_assert_int_eq(s21_create_view(&A, 4, 4, 4, 4, &V2), OK);
+  ck_assert_int_eq(s21_create_view(&A, 8, 0, 4, 4, &V3), OK);
+  ck_assert_int_eq(s21_create_view(&A, 10, 0, 4, 4, &X), CALCULATION_ERROR);
+  ck_assert_int_eq(V2.matrix[1][2], A.matrix[5][6]);
+
+  s21_sum_matrix(&V1, &V2, &X);
+  ck_assert_int_eq(s21_sum_matrix_into(&V1, &V2, &V3), OK);
+  ck_assert_int_eq(s21_eq_matrix(&X, &V3), SUCCESS);
+
+  s21_mult_matrix(&V1, &V2, &Z);
+  ck_assert_int_eq(s21_mult_matrix_into(&V1, &V2, &V3), OK);
+  ck_assert_int_eq(s21_eq_matrix(&Z, &V3), SUCCESS);
+  ck_assert_int_eq(s21_mult_matrix_into(&V1, &V2, &V1), OK);
+  ck_assert_int_eq(s21_eq_matrix(&Z, &V1), SUCCESS);
+
+  s21_transpose(&V2, &Y);
+  ck_assert_int_eq(s21_transpose_into(&V2, &V3), OK);
+  ck_assert_int_eq(s21_eq_matrix(&Y, &V3), SUCCESS);
+  ck_assert_int_eq(A.matrix[8][1], A.matrix[5][4]);
+
+  s21_remove_matrix(&V1);
+  s21_remove_matrix(&V2);
+  s21_remove_matrix(&V3);
+  s21_remove_matrix(&X);
+  s21_remove_matrix(&Y);
+  s21_remove_matrix(&Z);
+  s21_remove_matrix(&A);
+}
+END_TEST
+
+START_TEST(s21_view_2) {
+  matrix_t A = {0};
+  matrix_t M = {0};
+  matrix_t V = {0};
+  matrix_t C = {0};
+
+  s21_create_matrix(5, 5, &A);
+  matrix_filling(1.0, &A);
+  for (int i = 0; i < 5; i++) A.matrix[i][i] += 10.0 * (i + 1);
+  s21_calc_complements(&A, &C);
+
+  ck_assert_int_eq(s21_create_minor_view(&A, 2, 0, &V), OK);
+  ck_assert_int_eq(V.rows, 4);
+  ck_assert_int_eq(V.columns, 4);
+  ck_assert_double_eq(V.matrix[2][0], A.matrix[3][1]);
+  double det = 0;
+  ck_assert_int_eq(s21_determinant(&V, &det), OK);
+  ck_assert_double_eq_tol(det, C.matrix[2][0], 1e-6);
+  s21_remove_matrix(&V);
+
+  ck_assert_int_eq(s21_create_minor_view(&A, 4, 4, &V), OK);
+  ck_assert_int_eq(s21_determinant(&V, &det), OK);
+  ck_assert_double_eq_tol(det, C.matrix[4][4], 1e-6);
+  ck_assert_int_eq(s21_inverse_matrix(&V, &M), OK);
+  s21_remove_matrix(&V);
+
+  for (int i = 0; i < 5; i++) {
+    for (int j = 1; j < 4; j++) {
+      ck_assert_int_eq(s21_create_minor_view(&A, i, j, &V), OK);
+      ck_assert_int_eq(V.rows, 4);
+      ck_assert_int_eq(V.columns, 4);
+      ck_assert_double_eq(V.matrix[3][j], A.matrix[i < 4 ? 4 : 3][j + 1]);
+      ck_assert_int_eq(s21_determinant(&V, &det), OK);
+      double sign = (i + j) % 2 ? -1.0 : 1.0;
+      ck_assert_double_eq_tol(sign * det, C.matrix[i][j], 1e-6);
+      s21_remove_matrix(&V);
+    }
+  }
+  ck_assert_int_eq(s21_create_minor_view(&A, 5, 2, &V), CALCULATION_ERROR);
+  ck_assert_int_eq(s21_create_minor_view(&A, 1, 5, &V), CALCULATION_ERROR);
+  ck_assert_int_eq(s21_create_minor_view(NULL, 1, 0, &V), INCORRECT_MATRIX);
+  double exact = 0;
+  s21_determinant(&A, &det);
+  ck_assert_int_eq(s21_determinant_exact(&A, &exact), OK);
+  ck_assert_double_eq_tol(exact, det, 1e-6 * fabs(det));
+
+  s21_remove_matrix(&A);
+  s21_remove_matrix(&M);
+  s21_remove_matrix(&C);
+}
+END_TEST
+
+START_TEST(s21_lazy_1) {
+  matrix_t A = {0};
+  matrix_t B = {0};
+  matrix_t At = {0};
+  matrix_t Bt = {0};
+  matrix_t L = {0};
+  matrix_t M = {0};
+  matrix_t P = {0};
+  matrix_t Q = {0};
+
+  s21_create_matrix(37, 21, &A);
+  s21_create_matrix(37, 21, &B);
+  matrix_filling(-2.5, &A);
+  matrix_filling(4.0, &B);
+  s21_transpose(&A, &At);
+  s21_transpose(&B, &Bt);
+
+  ck_assert_int_eq(s21_transpose_lazy(&A, &L), OK);
+  ck_assert_ptr_eq(L.matrix, A.matrix);
+  ck_assert_int_eq(L.rows, 21);
+  ck_assert_int_eq(L.columns, 37);
+  ck_assert_int_eq(s21_eq_matrix(&L, &At), SUCCESS);
+  ck_assert_int_eq(s21_eq_matrix(&L, &A), FAILURE);
+
+  s21_mult_matrix(&At, &B, &P);
+  ck_assert_int_eq(s21_mult_matrix(&L, &B, &Q), OK);
+  ck_assert_int_eq(s21_eq_matrix(&P, &Q), SUCCESS);
+  s21_remove_matrix(&Q);
+
+  s21_sum_matrix(&At, &Bt, &Q);
+  s21_remove_matrix(&P);
+  s21_transpose_lazy(&B, &M);
+  ck_assert_int_eq(s21_sum_matrix(&L, &M, &P), OK);
+  ck_assert_int_eq(s21_eq_matrix(&P, &Q), SUCCESS);
+  ck_assert_int_eq(s21_sub_matrix_into(&P, &At, &M), OK);
+  ck_assert_int_eq(s21_eq_matrix(&M, &Bt), SUCCESS);
+  ck_assert_int_eq(s21_mult_number_into(&A, 2.0, &A), OK);
+  ck_assert_int_eq(s21_mult_number_into(&L, 0.5, &L), OK);
+  s21_remove_matrix(&P);
+  s21_remove_matrix(&Q);
+
+  s21_transpose(&L, &P);
+  ck_assert_int_eq(s21_eq_matrix(&P, &A), SUCCESS);
+  ck_assert_int_eq(s21_materialize(&L, &Q), OK);
+  ck_assert_int_eq(Q.flags, 0);
+  ck_assert_double_eq(Q.matrix[3][17], A.matrix[17][3]);
+  ck_assert_int_eq(s21_transpose_inplace(&L), OK);
+  ck_assert_ptr_eq(L.matrix, A.matrix);
+  ck_assert_int_eq(s21_eq_matrix(&L, &A), SUCCESS);
+
+  s21_remove_matrix(&L);
+  s21_remove_matrix(&M);
+  ck_assert_int_eq(A.rows, 37);
+  s21_remove_matrix(&A);
+  s21_remove_matrix(&B);
+  s21_remove_matrix(&At);
+  s21_remove_matrix(&Bt);
+  s21_remove_matrix(&P);
+  s21_remove_matrix(&Q);
+}
+END_TEST
+
+START_TEST(s21_lazy_2) {
+  matrix_t A = {0};
+  matrix_t L = {0};
+  matrix_t C = {0};
+  matrix_t I = {0};
+  matrix_t T = {0};
+  matrix_t V = {0};
+  matrix_t R = {0};
+
+  s21_create_matrix(9, 9, &A);
+  matrix_filling(1.0, &A);
+  for (int i = 0; i < 9; i++) A.matrix[i][i] += 20.0 + i;
+  s21_transpose_lazy(&A, &L);
+
+  double det = 0;
+  double det_t = 0;
+  s21_determinant(&A, &det);
+  ck_assert_int_eq(s21_determinant(&L, &det_t), OK);
+  ck_assert_double_eq_tol(det, det_t, 1e-9 * fabs(det));
+
+  s21_inverse_matrix(&A, &I);
+  s21_transpose(&I, &T);
+  ck_assert_int_eq(s21_inverse_matrix(&L, &R), OK);
+  ck_assert_int_eq(s21_eq_matrix(&R, &T), SUCCESS);
+  s21_remove_matrix(&R);
+  s21_calc_complements(&A, &C);
+  s21_remove_matrix(&T);
+  s21_transpose(&C, &T);
+  ck_assert_int_eq(s21_calc_complements(&L, &R), OK);
+  ck_assert_int_eq(s21_eq_matrix(&R, &T), SUCCESS);
+  s21_remove_matrix(&R);
+
+  s21_create_matrix(9, 9, &R);
+  s21_transpose_lazy(&R, &V);
+  ck_assert_int_eq(s21_mult_matrix_into(&A, &A, &V), OK);
+  s21_remove_matrix(&T);
+  s21_mult_matrix(&L, &L, &T);
+  ck_assert_int_eq(s21_eq_matrix(&R, &T), SUCCESS);
+  ck_assert_int_eq(s21_transpose_into(&L, &R), OK);
+  ck_assert_int_eq(s21_eq_matrix(&R, &A), SUCCESS);
+  s21_remove_matrix(&V);
+
+  ck_assert_int_eq(s21_create_view(&L, 2, 5, 3, 4, &V), OK);
+  s21_remove_matrix(&T);
+  s21_materialize(&V, &T);
+  ck_assert_int_eq(T.rows, 3);
+  ck_assert_double_eq(T.matrix[1][2], A.matrix[7][3]);
+  s21_remove_matrix(&V);
+  ck_assert_int_eq(s21_create_minor_view(&L, 0, 4, &V), OK);
+  ck_assert_int_eq(s21_determinant(&V, &det), OK);
+  ck_assert_double_eq_tol(det, C.matrix[4][0], 1e-9 * fabs(det));
+  s21_remove_matrix(&V);
+  ck_assert_int_eq(s21_create_minor_view(&L, 4, 3, &V), OK);
+  ck_assert_double_eq(V.matrix[3][5], A.matrix[4][6]);
+  ck_assert_int_eq(s21_determinant(&V, &det), OK);
+  ck_assert_double_eq_tol(det, -C.matrix[3][4], 1e-9 * fabs(det));
+
+  s21_remove_matrix(&V);
+  s21_remove_matrix(&L);
+  s21_remove_matrix(&A);
+  s21_remove_matrix(&I);
+  s21_remove_matrix(&T);
+  s21_remove_matrix(&R);
+  s21_remove_matrix(&C);
+}
+END_TEST
+
+START_TEST(s21_float_1) {
+  matrix_t A = {0};
+  matrix_t B = {0};
+  matrix_t D = {0};
+  matrix_t W = {0};
+  matrixf_t a = {0};
+  matrixf_t b = {0};
+  matrixf_t r = {0};
+  matrixf_t t = {0};
+
+  s21_create_matrix(23, 37, &A);
+  s21_create_matrix(23, 37, &B);
+  matrix_filling(-0.75, &A);
+  matrix_filling(0.25, &B);
+  ck_assert_int_eq(s21_matrix_to_float(&A, &a), OK);
+  ck_assert_int_eq(s21_matrix_to_float(&B, &b), OK);
+  ck_assert_int_eq(a.stride % 16, 0);
+  ck_assert_double_eq(a.matrix[22][36], (float)A.matrix[22][36]);
+
+  ck_assert_int_eq(s21_sum_matrix_f(&a, &b, &r), OK);
+  s21_sum_matrix(&A, &B, &D);
+  ck_assert_int_eq(s21_matrix_to_double(&r, &W), OK);
+  ck_assert_int_eq(s21_eq_matrix(&D, &W), SUCCESS);
+  ck_assert_int_eq(s21_sub_matrix_into_f(&r, &b, &r), OK);
+  ck_assert_int_eq(s21_eq_matrix_f(&r, &a), SUCCESS);
+  ck_assert_int_eq(s21_mult_number_into_f(&r, 2.0f, &r), OK);
+  ck_assert_int_eq(s21_eq_matrix_f(&r, &a), FAILURE);
+  ck_assert_int_eq(s21_sub_matrix_into_f(&r, &a, &r), OK);
+  ck_assert_int_eq(s21_eq_matrix_f(&r, &a), SUCCESS);
+
+  ck_assert_int_eq(s21_transpose_f(&a, &t), OK);
+  ck_assert_int_eq(t.rows, 37);
+  ck_assert_double_eq(t.matrix[36][5], a.matrix[5][36]);
+  ck_assert_int_eq(s21_transpose_into_f(&t, &r), OK);
+  ck_assert_int_eq(s21_eq_matrix_f(&r, &a), SUCCESS);
+  ck_assert_int_eq(s21_sum_matrix_f(&a, &t, &r), CALCULATION_ERROR);
+  ck_assert_int_eq(s21_mult_number_f(NULL, 1.0f, &r), INCORRECT_MATRIX);
+  ck_assert_int_eq(s21_create_matrix_f(0, 3, &r), INCORRECT_MATRIX);
+
+  s21_remove_matrix(&A);
+  s21_remove_matrix(&B);
+  s21_remove_matrix(&D);
+  s21_remove_matrix(&W);
+  s21_remove_matrix_f(&a);
+  s21_remove_matrix_f(&b);
+  s21_remove_matrix_f(&r);
+  s21_remove_matrix_f(&t);
+}
+END_TEST
+
+START_TEST(s21_float_2) {
+  int dims[][3] = {{7, 5, 3}, {70, 45, 53}, {131, 259, 67}};
+  for (int d = 0; d < 3; d++) {
+    matrix_t A = {0};
+    matrix_t B = {0};
+    matrix_t C = {0};
+    matrix_t W = {0};
+    matrixf_t a = {0};
+    matrixf_t b = {0};
+    matrixf_t c = {0};
+
+    s21_create_matrix(dims[d][0], dims[d][1], &A);
+    s21_create_matrix(dims[d][1], dims[d][2], &B);
+    for (int i = 0; i < A.rows; i++) {
+      for (int j = 0; j < A.columns; j++) A.matrix[i][j] = (i * 7 + j) % 11;
+    }
+    for (int i = 0; i < B.rows; i++) {
+      for (int j = 0; j < B.columns; j++) B.matrix[i][j] = (i + 3 * j) % 5;
+    }
+    s21_matrix_to_float(&A, &a);
+    s21_matrix_to_float(&B, &b);
+    s21_mult_matrix(&A, &B, &C);
+    ck_assert_int_eq(s21_mult_matrix_f(&a, &b, &c), OK);
+    s21_matrix_to_double(&c, &W);
+    ck_assert_int_eq(s21_eq_matrix(&C, &W), SUCCESS);
+    ck_assert_int_eq(s21_mult_matrix_f(&b, &b, &c), CALCULATION_ERROR);
+
+    s21_remove_matrix(&A);
+    s21_remove_matrix(&B);
+    s21_remove_matrix(&C);
+    s21_remove_matrix(&W);
+    s21_remove_matrix_f(&a);
+    s21_remove_matrix_f(&b);
+    s21_remove_matrix_f(&c);
+  }
+}
+END_TEST
+
+START_TEST(s21_float_3) {
+  matrix_t A = {0};
+  matrixf_t a = {0};
+  matrixf_t r = {0};
+  matrixf_t p = {0};
+  matrixf_t e = {0};
+
+  s21_create_matrix(6, 6, &A);
+  matrix_filling(0.5, &A);
+  for (int i = 0; i < 6; i++) A.matrix[i][i] += 8.0;
+  s21_matrix_to_float(&A, &a);
+
+  double det = 0;
+  double det_f = 0;
+  s21_determinant(&A, &det);
+  ck_assert_int_eq(s21_determinant_f(&a, &det_f), OK);
+  ck_assert_double_eq_tol(det_f, det, 1e-5 * fabs(det));
+
+  ck_assert_int_eq(s21_inverse_matrix_f(&a, &r), OK);
+  s21_mult_matrix_f(&a, &r, &p);
+  s21_create_matrix_f(6, 6, &e);
+  for (int i = 0; i < 6; i++) e.matrix[i][i] = 1.0f;
+  ck_assert_int_eq(s21_eq_matrix_f(&p, &e), SUCCESS);
+  ck_assert_int_eq(s21_mult_matrix_into_f(&a, &r, &r), OK);
+  ck_assert_int_eq(s21_eq_matrix_f(&r, &e), SUCCESS);
+  s21_remove_matrix_f(&r);
+
+  matrix_t C = {0};
+  s21_calc_complements(&A, &C);
+  ck_assert_int_eq(s21_calc_complements_f(&a, &r), OK);
+  ck_assert_double_eq_tol(r.matrix[0][0], C.matrix[0][0], 1e-6 * det);
+  ck_assert_double_eq_tol(r.matrix[2][3], C.matrix[2][3], 1e-6 * det);
+  s21_remove_matrix(&C);
+  s21_remove_matrix_f(&r);
+  for (int j = 0; j < 6; j++) a.matrix[3][j] = a.matrix[1][j];
+  ck_assert_int_eq(s21_inverse_matrix_f(&a, &r), CALCULATION_ERROR);
+
+  s21_remove_matrix(&A);
+  s21_remove_matrix_f(&a);
+  s21_remove_matrix_f(&r);
+  s21_remove_matrix_f(&p);
+  s21_remove_matrix_f(&e);
+}
+END_TEST
+
+static void spd_filling(int n, matrix_t *A) {
+  matrix_t M = {0};
+  s21_create_matrix(n, n, &M);
+  for (int i = 0; i < n; i++) {
+    for (int j = 0; j < n; j++) M.matrix[i][j] = ((i * 13 + j * 7) % 17) / 8.0;
+  }
+  s21_create_matrix(n, n, A);
+  s21_gemm(S21_NO_TRANS, S21_TRANS, 1.0, &M, &M, 0.0, A);
+  for (int i = 0; i < n; i++) A->matrix[i][i] += n;
+  s21_remove_matrix(&M);
+}
+
+START_TEST(s21_cholesky_1) {
+  int sizes[] = {1, 5, 70, 150};
+  for (int s = 0; s < 4; s++) {
+    int n = sizes[s];
+    matrix_t A = {0};
+    matrix_t L = {0};
+    matrix_t P = {0};
+    matrix_t B = {0};
+    matrix_t X = {0};
+    matrix_t R = {0};
+
+    spd_filling(n, &A);
+    ck_assert_int_eq(s21_cholesky(&A, &L), OK);
+    for (int i = 0; i + 1 < n; i++) ck_assert_double_eq(L.matrix[i][n - 1], 0);
+    s21_create_matrix(n, n, &P);
+    s21_gemm(S21_NO_TRANS, S21_TRANS, 1.0, &L, &L, 0.0, &P);
+    ck_assert_int_eq(s21_eq_matrix(&A, &P), SUCCESS);
+
+    double det = 0;
+    double det_lu = 0;
+    double log_det = 0;
+    ck_assert_int_eq(s21_cholesky_determinant(&A, &det), OK);
+    for (int i = 0; i < n; i++) log_det += log(L.matrix[i][i] * L.matrix[i][i]);
+    s21_create_matrix(n, n, &R);
+    for (int i = 0; i < n; i++) {
+      for (int j = 0; j < n; j++) R.matrix[n - 1 - i][j] = A.matrix[i][j] / n;
+    }
+    s21_determinant(&R, &det_lu);
+    if ((n / 2) % 2) det_lu = -det_lu;
+    double log_det_lu = log(det_lu) + n * log(n);
+    ck_assert(isfinite(log_det));
+    ck_assert(isfinite(log_det_lu));
+    ck_assert_double_eq_tol(log_det, log_det_lu, 1e-9 * fabs(log_det) + 1e-12);
+    if (isfinite(det)) {
+      ck_assert_double_eq_tol(log(det), log_det, 1e-9 * fabs(log_det) + 1e-12);
+    }
+
+    s21_create_matrix(n, 3, &B);
+    for (int i = 0; i < n; i++) {
+      for (int j = 0; j < 3; j++) B.matrix[i][j] = (i + 1) * (j - 1);
+    }
+    ck_assert_int_eq(s21_cholesky_solve(&A, &B, &X), OK);
+    s21_remove_matrix(&P);
+    s21_mult_matrix(&A, &X, &P);
+    ck_assert_int_eq(s21_eq_matrix(&P, &B), SUCCESS);
+
+    s21_remove_matrix(&A);
+    s21_remove_matrix(&L);
+    s21_remove_matrix(&P);
+    s21_remove_matrix(&B);
+    s21_remove_matrix(&X);
+    s21_remove_matrix(&R);
+  }
+}
+END_TEST
+
+START_TEST(s21_cholesky_2) {
+  matrix_t A = {0};
+  matrix_t I = {0};
+  matrix_t J = {0};
+  matrix_t P = {0};
+  matrix_t E = {0};
+
+  spd_filling(150, &A);
+  s21_create_matrix(150, 150, &E);
+  for (int i = 0; i < 150; i++) E.matrix[i][i] = 1.0;
+  ck_assert_int_eq(s21_cholesky_inverse(&A, &I), OK);
+  s21_mult_matrix(&A, &I, &P);
+  ck_assert_int_eq(s21_eq_matrix(&P, &E), SUCCESS);
+  ck_assert_int_eq(s21_inverse_matrix(&A, &J), OK);
+  ck_assert_int_eq(s21_eq_matrix(&I, &J), SUCCESS);
+  s21_remove_matrix(&I);
+  s21_remove_matrix(&J);
+
+  A.matrix[3][3] = -1.0;
+  ck_assert_int_eq(s21_cholesky(&A, &I), CALCULATION_ERROR);
+  A.matrix[3][3] = 1e-3;
+  ck_assert_int_eq(s21_cholesky_inverse(&A, &I), CALCULATION_ERROR);
+  ck_assert_int_eq(s21_inverse_matrix(&A, &J), OK);
+  s21_remove_matrix(&P);
+  s21_mult_matrix(&A, &J, &P);
+  ck_assert_int_eq(s21_eq_matrix(&P, &E), SUCCESS);
+  A.matrix[3][3] = 200.0;
+  A.matrix[4][7] += 1.0;
+  double det = 0;
+  ck_assert_int_eq(s21_cholesky_determinant(&A, &det), CALCULATION_ERROR);
+  ck_assert_int_eq(s21_cholesky_solve(&A, &E, &I), CALCULATION_ERROR);
+  ck_assert_int_eq(s21_cholesky(NULL, &I), INCORRECT_MATRIX);
+
+  s21_remove_matrix(&A);
+  s21_remove_matrix(&J);
+  s21_remove_matrix(&P);
+  s21_remove_matrix(&E);
+}
+END_TEST
+
+static void qr_check(int m, int n) {
+  matrix_t A = {0};
+  matrix_t Q = {0};
+  matrix_t R = {0};
+  matrix_t P = {0};
+  matrix_t E = {0};
+
+  s21_create_matrix(m, n, &A);
+  for (int i = 0; i < m; i++) {
+    for (int j = 0; j < n; j++) {
+      A.matrix[i][j] = sin(i * j * 0.31 + i * 1.3 + 0.2);
+    }
+  }
+  ck_assert_int_eq(s21_qr(&A, &Q, &R), OK);
+  ck_assert_int_eq(Q.rows, m);
+  ck_assert_int_eq(R.columns, n);
+  for (int i = 0; i < n; i++) {
+    for (int j = 0; j < i; j++) ck_assert_double_eq(R.matrix[i][j], 0.0);
+  }
+  s21_mult_matrix(&Q, &R, &P);
+  ck_assert_int_eq(s21_eq_matrix(&P, &A), SUCCESS);
+  s21_create_matrix(n, n, &E);
+  s21_gemm(S21_TRANS, S21_NO_TRANS, 1.0, &Q, &Q, 0.0, &E);
+  for (int i = 0; i < n; i++) {
+    for (int j = 0; j < n; j++) {
+      ck_assert_double_eq_tol(E.matrix[i][j], i == j, 1e-12);
+    }
+  }
+  s21_remove_matrix(&A);
+  s21_remove_matrix(&Q);
+  s21_remove_matrix(&R);
+  s21_remove_matrix(&P);
+  s21_remove_matrix(&E);
+}
+
+START_TEST(s21_qr_1) {
+  qr_check(1, 1);
+  qr_check(5, 3);
+  qr_check(64, 64);
+  qr_check(70, 45);
+  qr_check(300, 97);
+
+  matrix_t A = {0};
+  matrix_t Q = {0};
+  matrix_t R = {0};
+  s21_create_matrix(3, 4, &A);
+  ck_assert_int_eq(s21_qr(&A, &Q, &R), CALCULATION_ERROR);
+  ck_assert_int_eq(s21_qr(NULL, &Q, &R), INCORRECT_MATRIX);
+  s21_remove_matrix(&A);
+}
+END_TEST
+
+START_TEST(s21_qr_2) {
+  matrix_t A = {0};
+  matrix_t X = {0};
+  matrix_t B = {0};
+  matrix_t S = {0};
+
+  s21_create_matrix(120, 40, &A);
+  s21_create_matrix(40, 3, &X);
+  for (int i = 0; i < 120; i++) {
+    for (int j = 0; j < 40; j++) {
+      A.matrix[i][j] = cos(i * 0.37 * j + i + j * j * 0.1);
+    }
+  }
+  for (int i = 0; i < 40; i++) {
+    for (int j = 0; j < 3; j++) X.matrix[i][j] = i - j * 2.5;
+  }
+  s21_mult_matrix(&A, &X, &B);
+  ck_assert_int_eq(s21_least_squares(&A, &B, &S), OK);
+  ck_assert_int_eq(s21_eq_matrix(&S, &X), SUCCESS);
+  s21_remove_matrix(&S);
+
+  matrix_t L = {0};
+  matrix_t N = {0};
+  matrix_t AtB = {0};
+  B.matrix[7][1] += 3.0;
+  B.matrix[90][0] -= 1.0;
+  ck_assert_int_eq(s21_least_squares(&A, &B, &S), OK);
+  s21_create_matrix(40, 40, &N);
+  s21_create_matrix(40, 3, &AtB);
+  s21_gemm(S21_TRANS, S21_NO_TRANS, 1.0, &A, &A, 0.0, &N);
+  s21_gemm(S21_TRANS, S21_NO_TRANS, 1.0, &A, &B, 0.0, &AtB);
+  ck_assert_int_eq(s21_cholesky_solve(&N, &AtB, &L), OK);
+  for (int i = 0; i < 40; i++) {
+    for (int j = 0; j < 3; j++) {
+      ck_assert_double_eq_tol(S.matrix[i][j], L.matrix[i][j], 1e-6);
+    }
+  }
+  s21_remove_matrix(&S);
+
+  for (int i = 0; i < 120; i++) A.matrix[i][5] = 2.0 * A.matrix[i][9];
+  ck_assert_int_eq(s21_least_squares(&A, &B, &S), CALCULATION_ERROR);
+  ck_assert_int_eq(s21_least_squares(&X, &B, &S), CALCULATION_ERROR);
+
+  s21_remove_matrix(&A);
+  s21_remove_matrix(&X);
+  s21_remove_matrix(&B);
+  s21_remove_matrix(&L);
+  s21_remove_matrix(&N);
+  s21_remove_matrix(&AtB);
+}
+END_TEST
+
+START_TEST(s21_solve_1) {
+  matrix_t A = {0};
+  matrix_t B = {0};
+  matrix_t X = {0};
+  matrix_t P = {0};
+
+  s21_create_matrix(130, 130, &A);
+  s21_create_matrix(130, 7, &B);
+  for (int i = 0; i < 130; i++) {
+    for (int j = 0; j < 130; j++) A.matrix[i][j] = sin(i * j * 0.3 + i + j);
+    for (int j = 0; j < 7; j++) B.matrix[i][j] = i * 0.5 - j;
+  }
+  ck_assert_int_eq(s21_solve(&A, &B, &X), OK);
+  ck_assert_int_eq(X.rows, 130);
+  ck_assert_int_eq(X.columns, 7);
+  s21_mult_matrix(&A, &X, &P);
+  ck_assert_int_eq(s21_eq_matrix(&P, &B), SUCCESS);
+  s21_remove_matrix(&X);
+  s21_remove_matrix(&P);
+
+  matrix_t At = {0};
+  matrix_t T = {0};
+  s21_transpose(&A, &T);
+  s21_transpose_lazy(&T, &At);
+  ck_assert_int_eq(s21_solve(&At, &B, &X), OK);
+  s21_mult_matrix(&A, &X, &P);
+  ck_assert_int_eq(s21_eq_matrix(&P, &B), SUCCESS);
+  s21_remove_matrix(&X);
+  s21_remove_matrix(&P);
+  s21_remove_matrix(&T);
+
+  matrix_t S = {0};
+  spd_filling(90, &S);
+  matrix_t C = {0};
+  s21_create_matrix(90, 2, &C);
+  for (int i = 0; i < 90; i++) C.matrix[i][i % 2] = 1.0;
+  ck_assert_int_eq(s21_solve(&S, &C, &X), OK);
+  s21_mult_matrix(&S, &X, &P);
+  ck_assert_int_eq(s21_eq_matrix(&P, &C), SUCCESS);
+
+  s21_remove_matrix(&A);
+  s21_remove_matrix(&B);
+  s21_remove_matrix(&X);
+  s21_remove_matrix(&P);
+  s21_remove_matrix(&S);
+  s21_remove_matrix(&C);
+}
+END_TEST
+
+START_TEST(s21_solve_2) {
+  matrix_t A = {0};
+  matrix_t B = {0};
+  matrix_t X = {0};
+  matrix_t I = {0};
+  matrix_t J = {0};
+
+  s21_create_matrix(100, 100, &A);
+  s21_create_matrix(100, 1, &B);
+  for (int i = 0; i < 100; i++) {
+    for (int j = 0; j < 100; j++) A.matrix[i][j] = cos(i * j * 0.13 + i);
+    B.matrix[i][0] = 1.0;
+  }
+  ck_assert_int_eq(s21_inverse_matrix(&A, &I), OK);
+  s21_mult_matrix(&I, &B, &J);
+  ck_assert_int_eq(s21_solve(&A, &B, &X), OK);
+  ck_assert_int_eq(s21_eq_matrix(&X, &J), SUCCESS);
+  s21_remove_matrix(&X);
+  s21_remove_matrix(&I);
+  s21_remove_matrix(&J);
+
+  for (int j = 0; j < 100; j++) A.matrix[40][j] = A.matrix[3][j] * 2.0;
+  ck_assert_int_eq(s21_solve(&A, &B, &X), CALCULATION_ERROR);
+  ck_assert_int_eq(s21_inverse_matrix(&A, &I), CALCULATION_ERROR);
+  ck_assert_int_eq(s21_solve(&B, &B, &X), CALCULATION_ERROR);
+  ck_assert_int_eq(s21_solve(&A, NULL, &X), INCORRECT_MATRIX);
+
+  s21_remove_matrix(&A);
+  s21_remove_matrix(&B);
+}
+END_TEST
+
+START_TEST(s21_factor_1) {
+  matrix_t A = {0};
+  matrix_t B = {0};
+  matrix_t X = {0};
+  matrix_t Y = {0};
+  factor_t F = {0};
+
+  s21_create_matrix(80, 80, &A);
+  s21_create_matrix(80, 3, &B);
+  for (int i = 0; i < 80; i++) {
+    for (int j = 0; j < 80; j++) A.matrix[i][j] = sin(i * j * 0.21 + i - j);
+    for (int j = 0; j < 3; j++) B.matrix[i][j] = i + j;
+  }
+  ck_assert_int_eq(s21_factorize(&A, &F), OK);
+  ck_assert_int_eq(F.kind, S21_FACTOR_LU);
+  double det = 0;
+  double expected = 0;
+  s21_determinant(&A, &expected);
+  ck_assert_int_eq(s21_factor_determinant(&F, &det), OK);
+  ck_assert_double_eq_tol(det, expected, fabs(expected) * 1e-12);
+  ck_assert_int_eq(s21_factor_inverse(&F, &X), OK);
+  ck_assert_int_eq(s21_inverse_matrix(&A, &Y), OK);
+  ck_assert_int_eq(s21_eq_matrix(&X, &Y), SUCCESS);
+  s21_remove_matrix(&X);
+  s21_remove_matrix(&Y);
+  ck_assert_int_eq(s21_factor_solve(&F, &B, &X), OK);
+  ck_assert_int_eq(s21_solve(&A, &B, &Y), OK);
+  ck_assert_int_eq(s21_eq_matrix(&X, &Y), SUCCESS);
+  s21_remove_matrix(&X);
+  s21_remove_matrix(&Y);
+  int rank = 0;
+  int singular = 1;
+  ck_assert_int_eq(s21_factor_rank(&F, &rank), OK);
+  ck_assert_int_eq(rank, 80);
+  ck_assert_int_eq(s21_factor_singular(&F, &singular), OK);
+  ck_assert_int_eq(singular, 0);
+
+  for (int j = 0; j < 80; j++) A.matrix[5][j] *= 2.0;
+  s21_invalidate_factor(&F);
+  s21_determinant(&A, &expected);
+  ck_assert_int_eq(s21_factor_determinant(&F, &det), OK);
+  ck_assert_double_eq_tol(det, expected, fabs(expected) * 1e-12);
+
+  for (int j = 0; j < 80; j++) A.matrix[6][j] = A.matrix[9][j] * 4.0;
+  s21_invalidate_factor(&F);
+  ck_assert_int_eq(s21_factor_singular(&F, &singular), OK);
+  ck_assert_int_eq(singular, 1);
+  ck_assert_int_eq(F.kind, S21_FACTOR_LU_FULL);
+  ck_assert_int_eq(s21_factor_rank(&F, &rank), OK);
+  ck_assert_int_eq(rank, 79);
+  ck_assert_int_eq(s21_factor_determinant(&F, &det), OK);
+  ck_assert_double_eq(det, 0.0);
+  ck_assert_int_eq(s21_factor_inverse(&F, &X), CALCULATION_ERROR);
+  ck_assert_int_eq(s21_factor_solve(&F, &B, &X), CALCULATION_ERROR);
+
+  s21_remove_factor(&F);
+  ck_assert_ptr_null(F.pivots);
+  ck_assert_int_eq(s21_factor_rank(&F, &rank), INCORRECT_MATRIX);
+  s21_remove_matrix(&A);
+  s21_remove_matrix(&B);
+}
+END_TEST
+
+START_TEST(s21_factor_2) {
+  matrix_t A = {0};
+  matrix_t L = {0};
+  matrix_t X = {0};
+  matrix_t Y = {0};
+  factor_t F = {0};
+
+  spd_filling(70, &A);
+  s21_transpose_lazy(&A, &L);
+  ck_assert_int_eq(s21_factorize(&L, &F), OK);
+  ck_assert_int_eq(F.kind, S21_FACTOR_CHOLESKY);
+  ck_assert_int_eq(s21_factor_inverse(&F, &X), OK);
+  ck_assert_int_eq(s21_inverse_matrix(&A, &Y), OK);
+  ck_assert_int_eq(s21_eq_matrix(&X, &Y), SUCCESS);
+  s21_remove_matrix(&X);
+  s21_remove_matrix(&Y);
+  ck_assert_int_eq(s21_factor_solve(&F, &A, &X), OK);
+  for (int i = 0; i < 70; i++) {
+    for (int j = 0; j < 70; j++) {
+      ck_assert_double_eq_tol(X.matrix[i][j], i == j, 1e-9);
+    }
+  }
+  s21_remove_matrix(&X);
+  s21_remove_factor(&F);
+  s21_remove_matrix(&A);
+
+  s21_create_matrix(6, 6, &A);
+  for (int i = 0; i < 6; i++) {
+    for (int j = 0; j < 6; j++) A.matrix[i][j] = (i % 3 + 1) * (j + 1);
+  }
+  for (int j = 0; j < 6; j++) A.matrix[2][j] = j * j;
+  for (int j = 0; j < 6; j++) A.matrix[3][j] = 0;
+  ck_assert_int_eq(s21_factorize(&A, &F), OK);
+  int rank = 0;
+  ck_assert_int_eq(s21_factor_rank(&F, &rank), OK);
+  ck_assert_int_eq(rank, 2);
+  s21_remove_factor(&F);
+  s21_remove_matrix(&A);
+
+  s21_create_matrix(4, 5, &A);
+  ck_assert_int_eq(s21_factorize(&A, &F), CALCULATION_ERROR);
+  ck_assert_ptr_null(F.lu.matrix);
+  ck_assert_int_eq(s21_factorize(NULL, &F), INCORRECT_MATRIX);
+  s21_remove_matrix(&A);
+}
+END_TEST
+
+static void minor_complements(matrix_t *A, matrix_t *result) {
+  int n = A->rows;
+  matrix_t M = {0};
+  s21_create_matrix(n, n, result);
+  s21_create_matrix(n - 1, n - 1, &M);
+  for (int i = 0; i < n; i++) {
+    for (int j = 0; j < n; j++) {
+      double det = 0;
+      s21_fill_matrix(i, j, A, &M);
+      s21_determinant(&M, &det);
+      result->matrix[i][j] = (i + j) % 2 ? -det : det;
+    }
+  }
+  s21_remove_matrix(&M);
+}
+
+START_TEST(s21_calc_complements_5) {
+  matrix_t A = {0};
+  matrix_t C = {0};
+  matrix_t E = {0};
+
+  s21_create_matrix(8, 8, &A);
+  for (int i = 0; i < 8; i++) {
+    for (int j = 0; j < 8; j++) {
+      A.matrix[i][j] = (i * i + 3 * j * j + i * j) % 7 + (i == j) * 5;
+    }
+  }
+  for (int round = 0; round < 3; round++) {
+    if (round == 1) {
+      for (int j = 0; j < 8; j++) {
+        A.matrix[7][j] = A.matrix[0][j] - A.matrix[2][j];
+      }
+    } else if (round == 2) {
+      for (int i = 0; i < 8; i++) A.matrix[i][4] = 3 * A.matrix[i][1];
+    }
+    ck_assert_int_eq(s21_calc_complements(&A, &C), OK);
+    minor_complements(&A, &E);
+    ck_assert_int_eq(s21_eq_matrix(&C, &E), SUCCESS);
+    s21_remove_matrix(&C);
+    s21_remove_matrix(&E);
+  }
+  for (int j = 0; j < 8; j++) A.matrix[6][j] = 2 * A.matrix[1][j];
+  s21_create_matrix(8, 8, &E);
+  ck_assert_int_eq(s21_calc_complements(&A, &C), OK);
+  ck_assert_int_eq(s21_eq_matrix(&C, &E), SUCCESS);
+
+  s21_remove_matrix(&A);
+  s21_remove_matrix(&C);
+  s21_remove_matrix(&E);
+}
+END_TEST
+
+START_TEST(s21_calc_complements_6) {
+  matrix_t A = {0};
+  matrix_t C = {0};
+  matrix_t I = {0};
+
+  s21_create_matrix(300, 300, &A);
+  for (int i = 0; i < 300; i++) {
+    for (int j = 0; j < 300; j++) A.matrix[i][j] = sin(i * j * 0.1 + i - j);
+    A.matrix[i][i] += 4.0;
+  }
+  double det = 0;
+  s21_determinant(&A, &det);
+  ck_assert_int_eq(s21_calc_complements(&A, &C), OK);
+  ck_assert_int_eq(s21_inverse_matrix(&A, &I), OK);
+  for (int i = 0; i < 300; i++) {
+    for (int j = 0; j < 300; j++) {
+      double expected = det * I.matrix[j][i];
+      ck_assert_double_eq_tol(C.matrix[i][j], expected,
+                              fabs(det) * 1e-12 + 1e-7);
+    }
+  }
+
+  s21_remove_matrix(&A);
+  s21_remove_matrix(&C);
+  s21_remove_matrix(&I);
+}
+END_TEST
+
+START_TEST(s21_factor_3) {
+  matrix_t A = {0};
+  matrix_t B = {0};
+  matrix_t X = {0};
+  factor_t F = {0};
+  double v[9] = {0, -3 + ldexp(1.0, -51), -3, 0, -1, -1, -2, 2, 0};
+
+  s21_create_matrix(3, 3, &A);
+  s21_create_matrix(3, 1, &B);
+  for (int i = 0; i < 9; i++) A.matrix[i / 3][i % 3] = v[i];
+  for (int i = 0; i < 3; i++) B.matrix[i][0] = 1.0;
+  ck_assert_int_eq(s21_factorize(&A, &F), OK);
+  ck_assert_int_eq(F.kind, S21_FACTOR_LU_FULL);
+  int rank = 0;
+  int singular = 1;
+  double det = 0;
+  ck_assert_int_eq(s21_factor_rank(&F, &rank), OK);
+  ck_assert_int_eq(s21_factor_singular(&F, &singular), OK);
+  ck_assert_int_eq(s21_factor_determinant(&F, &det), OK);
+  ck_assert_int_eq(rank, 3);
+  ck_assert_int_eq(singular, 0);
+  ck_assert(det != 0.0);
+  ck_assert_int_eq(s21_factor_inverse(&F, &X), OK);
+  s21_remove_matrix(&X);
+  ck_assert_int_eq(s21_factor_solve(&F, &B, &X), OK);
+  s21_remove_matrix(&X);
+
+  for (int j = 0; j < 3; j++) A.matrix[0][j] = 3.0 * A.matrix[1][j];
+  s21_invalidate_factor(&F);
+  ck_assert_int_eq(s21_factor_rank(&F, &rank), OK);
+  ck_assert_int_eq(s21_factor_singular(&F, &singular), OK);
+  ck_assert_int_eq(s21_factor_determinant(&F, &det), OK);
+  ck_assert_int_eq(rank, 2);
+  ck_assert_int_eq(singular, 1);
+  ck_assert_double_eq(det, 0.0);
+  ck_assert_int_eq(s21_factor_inverse(&F, &X), CALCULATION_ERROR);
+
+  s21_remove_factor(&F);
+  s21_remove_matrix(&A);
+  s21_remove_matrix(&B);
+}
+END_TEST
+
+START_TEST(s21_sparse_1) {
+  matrix_t A = {0};
+  matrix_t At = {0};
+  matrix_t D = {0};
+  sparse_t csr = {0};
+  sparse_t csc = {0};
+  sparse_t T = {0};
+
+  s21_create_matrix(9, 13, &A);
+  sparse_filling(&A);
+  s21_transpose(&A, &At);
+  ck_assert_int_eq(s21_dense_to_sparse(&A, S21_CSR, &csr), OK);
+  ck_assert_int_eq(csr.nnz, 24);
+  ck_assert_int_eq(s21_sparse_convert(&csr, S21_CSC, &csc), OK);
+  ck_assert_int_eq(csc.offsets[13], csr.nnz);
+  ck_assert_int_eq(s21_sparse_to_dense(&csc, &D), OK);
+  ck_assert_int_eq(s21_eq_matrix(&A, &D), SUCCESS);
+  s21_remove_matrix(&D);
+
+  ck_assert_int_eq(s21_sparse_transpose(&csr, &T), OK);
+  ck_assert_int_eq(T.format, S21_CSR);
+  ck_assert_int_eq(T.rows, 13);
+  ck_assert_int_eq(s21_sparse_to_dense(&T, &D), OK);
+  ck_assert_int_eq(s21_eq_matrix(&At, &D), SUCCESS);
+  s21_remove_matrix(&D);
+  s21_remove_sparse(&T);
+
+  ck_assert_int_eq(s21_sparse_transpose(&csc, &T), OK);
+  ck_assert_int_eq(s21_sparse_to_dense(&T, &D), OK);
+  ck_assert_int_eq(s21_eq_matrix(&At, &D), SUCCESS);
+
+  s21_remove_matrix(&A);
+  s21_remove_matrix(&At);
+  s21_remove_matrix(&D);
+  s21_remove_sparse(&csr);
+  s21_remove_sparse(&csc);
+  s21_remove_sparse(&T);
+  ck_assert_int_eq(s21_sparse_to_dense(&T, &D), INCORRECT_MATRIX);
+}
+END_TEST
+
+START_TEST(s21_sparse_2) {
+  matrix_t A = {0};
+  matrix_t B = {0};
+  matrix_t C = {0};
+  matrix_t D = {0};
+  sparse_t S = {0};
+  double x[13];
+  double y[9];
+
+  s21_create_matrix(9, 13, &A);
+  s21_create_matrix(13, 6, &B);
+  sparse_filling(&A);
+  matrix_filling(-3.0, &B);
+  s21_mult_matrix(&A, &B, &C);
+  for (int j = 0; j < 13; j++) x[j] = B.matrix[j][1];
+  for (int format = S21_CSR; format <= S21_CSC; format++) {
+    s21_dense_to_sparse(&A, format, &S);
+    ck_assert_int_eq(s21_sparse_mult_dense(&S, &B, &D), OK);
+    ck_assert_int_eq(s21_eq_matrix(&C, &D), SUCCESS);
+    ck_assert_int_eq(s21_sparse_mult_vector(&S, x, y), OK);
+    for (int i = 0; i < 9; i++) ck_assert_double_eq(y[i], C.matrix[i][1]);
+    ck_assert_int_eq(s21_sparse_mult_dense(&S, &A, &D), CALCULATION_ERROR);
+    s21_remove_matrix(&D);
+    s21_remove_sparse(&S);
+  }
+
+  s21_remove_matrix(&A);
+  s21_remove_matrix(&B);
+  s21_remove_matrix(&C);
+}
+END_TEST
+
+START_TEST(s21_sparse_3) {
+  int rows[6] = {2, 0, 2, 1, 0, 2};
+  int cols[6] = {1, 3, 1, 0, 2, 3};
+  double vals[6] = {1.0, 2.0, 3.0, 4.0, 5.0, -6.0};
+  sparse_t A = {0};
+  sparse_t B = {0};
+  sparse_t C = {0};
+  matrix_t D = {0};
+
+  ck_assert_int_eq(
+      s21_sparse_from_triplets(3, 4, 6, rows, cols, vals, S21_CSR, &A), OK);
+  ck_assert_int_eq(A.nnz, 5);
+  ck_assert_int_eq(A.indices[3], 1);
+  ck_assert_double_eq(A.values[3], 4.0);
+  cols[0] = 4;
+  ck_assert_int_eq(
+      s21_sparse_from_triplets(3, 4, 6, rows, cols, vals, S21_CSC, &B),
+      CALCULATION_ERROR);
+  cols[0] = 1;
+  for (int p = 0; p < 6; p++) vals[p] = -vals[p];
+  vals[5] = 1.0;
+  s21_sparse_from_triplets(3, 4, 6, rows, cols, vals, S21_CSC, &B);
+  ck_assert_int_eq(s21_sparse_sum(&A, &B, &C), OK);
+  ck_assert_int_eq(C.format, S21_CSR);
+  ck_assert_int_eq(C.nnz, 1);
+  s21_sparse_to_dense(&C, &D);
+  ck_assert_double_eq(D.matrix[2][3], -5.0);
+  s21_remove_matrix(&D);
+  s21_remove_sparse(&C);
+  s21_remove_sparse(&B);
+
+  s21_create_sparse(4, 3, 0, S21_CSR, &B);
+  ck_assert_int_eq(s21_sparse_sum(&A, &B, &C), CALCULATION_ERROR);
+  s21_remove_sparse(&A);
+  s21_remove_sparse(&B);
+}
+END_TEST
+
+START_TEST(s21_sparse_4) {
+  int n = 100000;
+  int *rows = malloc(2 * n * sizeof(int));
+  int *cols = malloc(2 * n * sizeof(int));
+  double *vals = malloc(2 * n * sizeof(double));
+  double *x = malloc(n * sizeof(double));
+  double *y = malloc(n * sizeof(double));
+  for (int i = 0; i < n; i++) {
+    rows[2 * i] = rows[2 * i + 1] = i;
+    cols[2 * i] = i;
+    cols[2 * i + 1] = (i + 1) % n;
+    vals[2 * i] = 2.0;
+    vals[2 * i + 1] = -1.0;
+    x[i] = i;
+  }
+  sparse_t A = {0};
+  ck_assert_int_eq(
+      s21_sparse_from_triplets(n, n, 2 * n, rows, cols, vals, S21_CSR, &A),
+      OK);
+  ck_assert_int_eq(s21_sparse_mult_vector(&A, x, y), OK);
+  ck_assert_double_eq(y[0], -1.0);
+  ck_assert_double_eq(y[n / 2], n / 2 - 1.0);
+  ck_assert_double_eq(y[n - 1], 2.0 * (n - 1));
+  s21_remove_sparse(&A);
+  free(rows);
+  free(cols);
+  free(vals);
+  free(x);
+  free(y);
+}
+END_TEST
+
+START_TEST(s21_sparse_5) {
+  int rows[24];
+  int cols[24];
+  double vals[24];
+  for (int p = 0; p < 24; p++) {
+    rows[p] = (23 - p) % 20;
+    cols[p] = p / 20;
+    vals[p] = p + 1.0;
+  }
+  for (int format = S21_CSR; format <= S21_CSC; format++) {
+    int *r = format == S21_CSR ? rows : cols;
+    int *c = format == S21_CSR ? cols : rows;
+    int m = format == S21_CSR ? 20 : 2;
+    int n = format == S21_CSR ? 2 : 20;
+    sparse_t A = {0};
+    matrix_t D = {0};
+    matrix_t E = {0};
+    s21_create_matrix(m, n, &E);
+    for (int p = 0; p < 24; p++) E.matrix[r[p]][c[p]] += vals[p];
+    ck_assert_int_eq(
+        s21_sparse_from_triplets(m, n, 24, r, c, vals, format, &A), OK);
+    ck_assert_int_eq(A.nnz, 24);
+    ck_assert_int_eq(s21_sparse_to_dense(&A, &D), OK);
+    ck_assert_int_eq(s21_eq_matrix(&E, &D), SUCCESS);
+    s21_remove_sparse(&A);
+    s21_remove_matrix(&D);
+    s21_remove_matrix(&E);
+  }
+}
+END_TEST
+
+START_TEST(s21_strassen_1) {
+  matrix_t A = {0};
+  matrix_t B = {0};
+  matrix_t C = {0};
+  matrix_t D = {0};
+
+  s21_create_matrix(67, 53, &A);
+  s21_create_matrix(53, 45, &B);
+  s21_create_matrix(67, 45, &D);
+  for (int i = 0; i < A.rows; i++) {
+    for (int j = 0; j < A.columns; j++) A.matrix[i][j] = sin(i + 2.0 * j);
+  }
+  for (int i = 0; i < B.rows; i++) {
+    for (int j = 0; j < B.columns; j++) B.matrix[i][j] = cos(3.0 * i - j);
+  }
+  s21_mult_matrix(&A, &B, &C);
+  for (int levels = 1; levels <= 3; levels++) {
+    s21_set_strassen_crossover(8);
+    s21_set_strassen_depth(levels);
+    ck_assert_int_eq(
+        s21_gemm(S21_NO_TRANS, S21_NO_TRANS, -2.0, &A, &B, 0.0, &D), OK);
+    s21_set_strassen_crossover(0);
+    for (int i = 0; i < D.rows; i++) {
+      for (int j = 0; j < D.columns; j++) {
+        ck_assert_double_eq_tol(D.matrix[i][j], -2.0 * C.matrix[i][j], 1e-11);
+      }
+    }
+  }
+  s21_set_strassen_depth(0);
+
+  s21_remove_matrix(&A);
+  s21_remove_matrix(&B);
+  s21_remove_matrix(&C);
+  s21_remove_matrix(&D);
+}
+END_TEST
+
+START_TEST(s21_strassen_2) {
+  ck_assert_int_eq(s21_strassen_workspace(64, 64, 64, 0), 0);
+  size_t one = s21_strassen_workspace(64, 64, 64, 1);
+  size_t two = s21_strassen_workspace(64, 64, 64, 2);
+  ck_assert(one >= 2 * s21_matrix_bytes(32, 32));
+  ck_assert(two > one);
+  ck_assert(s21_strassen_workspace(65, 64, 64, 1) >
+            one + s21_matrix_bytes(66, 64));
+  ck_assert_int_eq(s21_set_strassen_crossover(-5), 0);
+}
+END_TEST
+
+START_TEST(s21_small_1) {
+  matrix_t A = {0};
+  matrix_t C = {0};
+  matrix_t Ct = {0};
+  matrix_t P = {0};
+  matrix_t I = {0};
+  matrix_t AI = {0};
+  double det = 0;
+
+  s21_create_matrix(4, 4, &A);
+  double values[16] = {2, -1, 0, 3, 1, 4, -2, 0, 5, 0, 1, -1, 0, 2, 3, 1};
+  for (int i = 0; i < 16; i++) A.matrix[i / 4][i % 4] = values[i];
+  ck_assert_int_eq(s21_determinant(&A, &det), OK);
+  ck_assert_double_eq(det, 300.0);
+  ck_assert_int_eq(s21_calc_complements(&A, &C), OK);
+  s21_transpose(&C, &Ct);
+  s21_mult_matrix(&A, &Ct, &P);
+  ck_assert_int_eq(s21_inverse_matrix(&A, &I), OK);
+  s21_mult_matrix(&A, &I, &AI);
+  for (int i = 0; i < 4; i++) {
+    for (int j = 0; j < 4; j++) {
+      ck_assert_double_eq(P.matrix[i][j], (i == j) * 300.0);
+      ck_assert_double_eq_tol(AI.matrix[i][j], (i == j), 1e-12);
+    }
+  }
+
+  s21_remove_matrix(&A);
+  s21_remove_matrix(&C);
+  s21_remove_matrix(&Ct);
+  s21_remove_matrix(&P);
+  s21_remove_matrix(&I);
+  s21_remove_matrix(&AI);
+}
+END_TEST
+
+START_TEST(s21_small_2) {
+  matrix_t A = {0};
+  matrix_t R = {0};
+  double det = 1;
+
+  s21_create_matrix(4, 4, &A);
+  matrix_filling(1.0, &A);
+  ck_assert_int_eq(s21_determinant(&A, &det), OK);
+  ck_assert_double_eq(det, 0.0);
+  ck_assert_int_eq(s21_inverse_matrix(&A, &R), CALCULATION_ERROR);
+  s21_remove_matrix(&A);
+
+  s21_create_matrix(3, 3, &A);
+  matrix_filling(1.0, &A);
+  ck_assert_int_eq(s21_inverse_matrix(&A, &R), CALCULATION_ERROR);
+  A.matrix[2][2] = 10.0;
+  ck_assert_int_eq(s21_inverse_matrix_into(&A, &A), OK);
+  ck_assert_double_eq_tol(A.matrix[0][0], -2.0 / 3.0, 1e-12);
+  ck_assert_double_eq_tol(A.matrix[2][2], 1.0, 1e-12);
+  s21_remove_matrix(&A);
+}
+END_TEST
+
+static void rigid_filling(double angle, double shift, matrix_t *A) {
+  s21_create_matrix(4, 4, A);
+  A->matrix[0][0] = cos(angle);
+  A->matrix[0][1] = -sin(angle);
+  A->matrix[1][0] = sin(angle);
+  A->matrix[1][1] = cos(angle);
+  A->matrix[2][2] = 1.0;
+  A->matrix[3][3] = 1.0;
+  A->matrix[0][3] = shift;
+  A->matrix[1][3] = -2.0 * shift;
+  A->matrix[2][3] = 0.5 * shift;
+}
+
+START_TEST(s21_small_3) {
+  matrix_t E = {0};
+  s21_create_matrix(4, 4, &E);
+  for (int i = 0; i < 4; i++) E.matrix[i][i] = 1.0;
+  for (double shift = 1e4; shift <= 1e7; shift *= 10) {
+    matrix_t A = {0};
+    matrix_t R = {0};
+    matrix_t P = {0};
+    rigid_filling(0.3, shift, &A);
+    ck_assert_int_eq(s21_inverse_matrix(&A, &R), OK);
+    ck_assert_double_eq_tol(R.matrix[0][3], -cos(0.3) * shift - sin(0.3) *
+                            -2.0 * shift, shift * 1e-12);
+    s21_mult_matrix(&A, &R, &P);
+    ck_assert_int_eq(s21_eq_matrix(&P, &E), SUCCESS);
+    s21_remove_matrix(&A);
+    s21_remove_matrix(&R);
+    s21_remove_matrix(&P);
+  }
+  s21_remove_matrix(&E);
+
+  matrix_t A = {0};
+  matrix_t R = {0};
+  s21_create_matrix(2, 2, &A);
+  A.matrix[0][0] = 1e8;
+  A.matrix[0][1] = 1.0;
+  A.matrix[1][1] = 1e-8;
+  ck_assert_int_eq(s21_inverse_matrix(&A, &R), OK);
+  ck_assert_double_eq_tol(R.matrix[0][0], 1e-8, 1e-20);
+  ck_assert_double_eq_tol(R.matrix[0][1], -1.0, 1e-12);
+  ck_assert_double_eq_tol(R.matrix[1][1], 1e8, 1e-4);
+  s21_remove_matrix(&A);
+  s21_remove_matrix(&R);
+}
+END_TEST
+
+START_TEST(s21_batch_1) {
+  for (int n = 1; n <= 6; n++) {
+    matrix_t items[13];
+    batch_t A = {0};
+    batch_t R = {0};
+    batch_t T = {0};
+    for (int b = 0; b < 13; b++) {
+      s21_create_matrix(n, n, &items[b]);
+      for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+          items[b].matrix[i][j] = sin(b * 7.0 + i * 3.0 + j) + (i == j) * n;
+        }
+      }
+    }
+    ck_assert_int_eq(s21_batch_from_matrices(items, 13, &A), OK);
+    double det[13];
+    ck_assert_int_eq(s21_batch_determinant(&A, det), OK);
+    ck_assert_int_eq(s21_batch_inverse(&A, &R), OK);
+    ck_assert_int_eq(s21_batch_transpose(&A, &T), OK);
+    for (int b = 0; b < 13; b++) {
+      double expected = 0.0;
+      matrix_t inv = {0};
+      matrix_t got = {0};
+      s21_determinant(&items[b], &expected);
+      ck_assert_double_eq_tol(det[b], expected, 1e-9 * fabs(expected));
+      s21_inverse_matrix(&items[b], &inv);
+      s21_create_matrix(n, n, &got);
+      ck_assert_int_eq(s21_batch_get(&R, b, &got), OK);
+      ck_assert_int_eq(s21_eq_matrix(&inv, &got), SUCCESS);
+      ck_assert_int_eq(s21_batch_get(&T, b, &got), OK);
+      for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+          ck_assert_double_eq(got.matrix[i][j], items[b].matrix[j][i]);
+        }
+      }
+      s21_remove_matrix(&inv);
+      s21_remove_matrix(&got);
+      s21_remove_matrix(&items[b]);
+    }
+    s21_remove_batch(&A);
+    s21_remove_batch(&R);
+    s21_remove_batch(&T);
+  }
+}
+END_TEST
+
+START_TEST(s21_batch_2) {
+  matrix_t a[11];
+  matrix_t b[11];
+  matrix_t out[11];
+  batch_t A = {0};
+  batch_t B = {0};
+  batch_t C = {0};
+  for (int k = 0; k < 11; k++) {
+    s21_create_matrix(3, 4, &a[k]);
+    s21_create_matrix(4, 2, &b[k]);
+    matrix_filling(k - 5.0, &a[k]);
+    matrix_filling(0.5 * k, &b[k]);
+  }
+  s21_batch_from_matrices(a, 11, &A);
+  s21_batch_from_matrices(b, 11, &B);
+  ck_assert_int_eq(s21_batch_mult(&A, &A, &C), CALCULATION_ERROR);
+  ck_assert_int_eq(s21_batch_mult(&A, &B, &C), OK);
+  ck_assert_int_eq(s21_batch_to_matrices(&C, out), OK);
+  for (int k = 0; k < 11; k++) {
+    matrix_t expected = {0};
+    s21_mult_matrix(&a[k], &b[k], &expected);
+    ck_assert_int_eq(s21_eq_matrix(&expected, &out[k]), SUCCESS);
+    s21_remove_matrix(&expected);
+    s21_remove_matrix(&out[k]);
+    s21_remove_matrix(&a[k]);
+    s21_remove_matrix(&b[k]);
+  }
+  s21_remove_batch(&A);
+  s21_remove_batch(&B);
+  s21_remove_batch(&C);
+  ck_assert_int_eq(s21_batch_mult(&A, &B, &C), INCORRECT_MATRIX);
+}
+END_TEST
+
+START_TEST(s21_batch_3) {
+  batch_t A = {0};
+  batch_t R = {0};
+  matrix_t M = {0};
+  s21_create_matrix(3, 3, &M);
+  ck_assert_int_eq(s21_create_batch(3, 3, 3, &A), OK);
+  matrix_filling(1.0, &M);
+  s21_batch_set(&A, 0, &M);
+  M.matrix[2][2] = 10.0;
+  s21_batch_set(&A, 1, &M);
+  ck_assert_int_eq(s21_batch_set(&A, 3, &M), CALCULATION_ERROR);
+  ck_assert_int_eq(s21_batch_inverse(&A, &R), CALCULATION_ERROR);
+  ck_assert_ptr_null(R.data);
+  s21_batch_set(&A, 0, &M);
+  s21_batch_set(&A, 2, &M);
+  ck_assert_int_eq(s21_batch_inverse(&A, &R), OK);
+  s21_batch_get(&R, 1, &M);
+  ck_assert_double_eq_tol(M.matrix[0][0], -2.0 / 3.0, 1e-12);
+  ck_assert_double_eq_tol(M.matrix[2][2], 1.0, 1e-12);
+  s21_remove_batch(&R);
+  s21_remove_batch(&A);
+  s21_remove_matrix(&M);
+  ck_assert_int_eq(s21_create_batch(0, 3, 3, &A), INCORRECT_MATRIX);
+}
+END_TEST
+
+START_TEST(s21_batch_4) {
+  matrix_t items[9];
+  matrix_t out[9];
+  batch_t A = {0};
+  batch_t R = {0};
+  double shift = 1e4;
+  for (int b = 0; b < 9; b++, shift *= 3) {
+    rigid_filling(0.1 * b, shift, &items[b]);
+  }
+  ck_assert_int_eq(s21_batch_from_matrices(items, 9, &A), OK);
+  ck_assert_int_eq(s21_batch_inverse(&A, &R), OK);
+  ck_assert_int_eq(s21_batch_to_matrices(&R, out), OK);
+  for (int b = 0; b < 9; b++) {
+    matrix_t inv = {0};
+    ck_assert_int_eq(s21_inverse_matrix(&items[b], &inv), OK);
+    ck_assert_int_eq(s21_eq_matrix(&inv, &out[b]), SUCCESS);
+    s21_remove_matrix(&inv);
+    s21_remove_matrix(&out[b]);
+    s21_remove_matrix(&items[b]);
+  }
+  s21_remove_batch(&A);
+  s21_remove_batch(&R);
+
+  for (int b = 0; b < 9; b++) {
+    s21_create_matrix(2, 2, &items[b]);
+    items[b].matrix[0][0] = 1e8;
+    items[b].matrix[0][1] = b;
+    items[b].matrix[1][1] = 1e-8;
+  }
+  ck_assert_int_eq(s21_batch_from_matrices(items, 9, &A), OK);
+  ck_assert_int_eq(s21_batch_inverse(&A, &R), OK);
+  ck_assert_int_eq(s21_batch_to_matrices(&R, out), OK);
+  for (int b = 0; b < 9; b++) {
+    ck_assert_double_eq_tol(out[b].matrix[0][1], -1.0 * b, 1e-12);
+    ck_assert_double_eq_tol(out[b].matrix[1][1], 1e8, 1e-4);
+    s21_remove_matrix(&out[b]);
+    s21_remove_matrix(&items[b]);
+  }
+  s21_remove_batch(&A);
+  s21_remove_batch(&R);
+}
+END_TEST
+
 Suite *s21_matrix_suite(void) {
   Suite *suite;
 
@@ -1923,6 +4068,7 @@ Suite *s21_matrix_suite(void) {
   tcase_add_test(tcase_core, s21_create_matrix_7);
   tcase_add_test(tcase_core, s21_create_matrix_8);
   tcase_add_test(tcase_core, s21_create_matrix_9);
+  tcase_add_test(tcase_core, s21_create_matrix_10);
 
   tcase_add_test(tcase_core, s21_remove_matrix_1);
   tcase_add_test(tcase_core, s21_remove_matrix_2);
@@ -1969,10 +4115,16 @@ Suite *s21_matrix_suite(void) {
   tcase_add_test(tcase_core, s21_mult_matrix_5);
   tcase_add_test(tcase_core, s21_mult_matrix_6);
   tcase_add_test(tcase_core, s21_mult_matrix_7);
+  tcase_add_test(tcase_core, s21_mult_matrix_8);
+  tcase_add_test(tcase_core, s21_gemm_1);
+  tcase_add_test(tcase_core, s21_gemm_2);
 
   tcase_add_test(tcase_core, s21_transpose_1);
   tcase_add_test(tcase_core, s21_transpose_2);
   tcase_add_test(tcase_core, s21_transpose_3);
+  tcase_add_test(tcase_core, s21_transpose_4);
+  tcase_add_test(tcase_core, s21_transpose_5);
+  tcase_add_test(tcase_core, s21_transpose_6);
 
   tcase_add_test(tcase_core, s21_determinant_1);
   tcase_add_test(tcase_core, s21_determinant_2);
@@ -1981,6 +4133,9 @@ Suite *s21_matrix_suite(void) {
   tcase_add_test(tcase_core, s21_determinant_5);
   tcase_add_test(tcase_core, s21_determinant_6);
   tcase_add_test(tcase_core, s21_determinant_7);
+  tcase_add_test(tcase_core, s21_determinant_8);
+  tcase_add_test(tcase_core, s21_determinant_9);
+  tcase_add_test(tcase_core, s21_determinant_10);
 
   tcase_add_test(tcase_core, s21_calc_complements_1);
   tcase_add_test(tcase_core, s21_calc_complements_2);
@@ -1993,6 +4148,64 @@ Suite *s21_matrix_suite(void) {
   tcase_add_test(tcase_core, s21_inverse_matrix_4);
   tcase_add_test(tcase_core, s21_inverse_matrix_5);
   tcase_add_test(tcase_core, s21_inverse_matrix_6);
+  tcase_add_test(tcase_core, s21_inverse_matrix_7);
+  tcase_add_test(tcase_core, s21_inverse_matrix_8);
+  tcase_add_test(tcase_core, s21_inverse_matrix_9);
+
+  tcase_add_test(tcase_core, s21_simd_level_1);
+  tcase_add_test(tcase_core, s21_simd_level_2);
+  tcase_add_test(tcase_core, s21_threads_1);
+
+  tcase_add_test(tcase_core, s21_into_1);
+  tcase_add_test(tcase_core, s21_into_2);
+  tcase_add_test(tcase_core, s21_into_3);
+
+  tcase_add_test(tcase_core, s21_arena_1);
+  tcase_add_test(tcase_core, s21_arena_2);
+
+  tcase_add_test(tcase_core, s21_map_matrix_1);
+  tcase_add_test(tcase_core, s21_map_matrix_2);
+  tcase_add_test(tcase_core, s21_mult_matrix_file_1);
+
+  tcase_add_test(tcase_core, s21_view_1);
+  tcase_add_test(tcase_core, s21_view_2);
+
+  tcase_add_test(tcase_core, s21_lazy_1);
+  tcase_add_test(tcase_core, s21_lazy_2);
+
+  tcase_add_test(tcase_core, s21_float_1);
+  tcase_add_test(tcase_core, s21_float_2);
+  tcase_add_test(tcase_core, s21_float_3);
+
+  tcase_add_test(tcase_core, s21_cholesky_1);
+  tcase_add_test(tcase_core, s21_cholesky_2);
+  tcase_add_test(tcase_core, s21_qr_1);
+  tcase_add_test(tcase_core, s21_qr_2);
+  tcase_add_test(tcase_core, s21_solve_1);
+  tcase_add_test(tcase_core, s21_solve_2);
+  tcase_add_test(tcase_core, s21_factor_1);
+  tcase_add_test(tcase_core, s21_factor_2);
+  tcase_add_test(tcase_core, s21_factor_3);
+  tcase_add_test(tcase_core, s21_calc_complements_5);
+  tcase_add_test(tcase_core, s21_calc_complements_6);
+
+  tcase_add_test(tcase_core, s21_sparse_1);
+  tcase_add_test(tcase_core, s21_sparse_2);
+  tcase_add_test(tcase_core, s21_sparse_3);
+  tcase_add_test(tcase_core, s21_sparse_4);
+  tcase_add_test(tcase_core, s21_sparse_5);
+
+  tcase_add_test(tcase_core, s21_strassen_1);
+  tcase_add_test(tcase_core, s21_strassen_2);
+
+  tcase_add_test(tcase_core, s21_small_1);
+  tcase_add_test(tcase_core, s21_small_2);
+  tcase_add_test(tcase_core, s21_small_3);
+
+  tcase_add_test(tcase_core, s21_batch_1);
+  tcase_add_test(tcase_core, s21_batch_2);
+  tcase_add_test(tcase_core, s21_batch_3);
+  tcase_add_test(tcase_core, s21_batch_4);
 
   suite_add_tcase(suite, tcase_core);
 
@@ -0,0 +1,135 @@
+#include <limits.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "s21_internal.h"
+
+static _Thread_local arena_t *s21_bound_arena = NULL;
+
+size_t s21_align_bytes(size_t bytes) {
+  return (bytes + S21_ALIGNMENT - 1) / S21_ALIGNMENT * S21_ALIGNMENT;
+}
+
+size_t s21_matrix_bytes(int rows, int columns) {
+  size_t bytes = 0;
+  if (rows > 0 && columns > 0 && columns <= INT_MAX - S21_ALIGNMENT) {
+    bytes = s21_align_bytes(rows * sizeof(double *)) +
+            (size_t)rows * s21_row_stride(columns) * sizeof(double);
+  }
+  return bytes;
+}
+
+int s21_create_arena(size_t bytes, arena_t *result) {
+  int err_code = OK;
+  result->base = NULL;
+  result->size = 0;
+  result->used = 0;
+  if (bytes > 0 && bytes <= SIZE_MAX - S21_ALIGNMENT) {
+    bytes = s21_align_bytes(bytes);
+    result->base = (unsigned char *)aligned_alloc(S21_ALIGNMENT, bytes);
+  }
+  if (result->base != NULL) {
+    result->size = bytes;
+  } else {
+    err_code = INCORRECT_MATRIX;
+  }
+  return err_code;
+}
+
+void s21_remove_arena(arena_t *arena) {
+  if (arena) {
+    if (s21_bound_arena == arena) s21_bound_arena = NULL;
+    free(arena->base);
+    arena->base = NULL;
+    arena->size = 0;
+    arena->used = 0;
+  }
+}
+
+void *s21_arena_alloc(arena_t *arena, size_t bytes) {
+  void *block = NULL;
+  if (arena != NULL && arena->base != NULL) {
+    size_t offset = s21_align_bytes(arena->used);
+    if (offset <= arena->size && bytes <= arena->size - offset) {
+      block = arena->base + offset;
+      arena->used = offset + bytes;
+    }
+  }
+  return block;
+}
+
+size_t s21_arena_mark(arena_t *arena) { return arena->used; }
+
+void s21_arena_release(arena_t *arena, size_t mark) {
+  if (mark < arena->used) arena->used = mark;
+}
+
+void s21_arena_reset(arena_t *arena) { arena->used = 0; }
+
+arena_t *s21_bind_arena(arena_t *arena) {
+  arena_t *previous = s21_bound_arena;
+  s21_bound_arena = arena;
+  return previous;
+}
+
+int s21_create_matrix_arena(int rows, int columns, arena_t *arena,
+                            matrix_t *result) {
+  int err_code = OK;
+  size_t mark = arena ? arena->used : 0;
+  double **row_ptrs = NULL;
+  double *data = NULL;
+  int stride = 0;
+  if (rows > 0 && columns > 0 && columns <= INT_MAX - S21_ALIGNMENT) {
+    stride = s21_row_stride(columns);
+    row_ptrs = (double **)s21_arena_alloc(arena, rows * sizeof(double *));
+    data = (double *)s21_arena_alloc(
+        arena, (size_t)rows * stride * sizeof(double));
+  }
+  if (row_ptrs != NULL && data != NULL) {
+    result->matrix = row_ptrs;
+    result->data = data;
+    result->rows = rows;
+    result->columns = columns;
+    result->stride = stride;
+    result->flags = S21_BORROWED;
+    memset(data, 0, (size_t)rows * result->stride * sizeof(double));
+    for (int i = 0; i < rows; i++) {
+      row_ptrs[i] = data + (size_t)i * result->stride;
+    }
+  } else {
+    if (arena != NULL) s21_arena_release(arena, mark);
+    err_code = INCORRECT_MATRIX;
+  }
+  return err_code;
+}
+
+int s21_scratch_open(s21_scratch_t *scratch, size_t bytes) {
+  int err_code = OK;
+  arena_t *bound = s21_bound_arena;
+  scratch->previous = bound;
+  if (bound != NULL && bound->base != NULL &&
+      s21_align_bytes(bound->used) <= bound->size &&
+      bytes <= bound->size - s21_align_bytes(bound->used)) {
+    scratch->arena = bound;
+    scratch->mark = bound->used;
+  } else if (bytes == 0) {
+    memset(&scratch->local, 0, sizeof(scratch->local));
+    scratch->arena = &scratch->local;
+    scratch->mark = 0;
+  } else {
+    err_code = s21_create_arena(bytes, &scratch->local);
+    scratch->arena = &scratch->local;
+    scratch->mark = 0;
+    if (err_code == OK) s21_bound_arena = &scratch->local;
+  }
+  return err_code;
+}
+
+void s21_scratch_close(s21_scratch_t *scratch) {
+  if (scratch->arena == &scratch->local) {
+    s21_remove_arena(&scratch->local);
+  } else {
+    s21_arena_release(scratch->arena, scratch->mark);
+  }
+  s21_bound_arena = scratch->previous;
+}
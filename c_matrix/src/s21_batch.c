@@ -0,0 +1,413 @@
+#include <limits.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "s21_internal.h"
+
+#define S21_INLINE static inline __attribute__((always_inline))
+#define S21_LANES S21_BATCH_LANES
+
+enum S21_BATCH_OP { S21_BATCH_DET, S21_BATCH_INVERSE, S21_BATCH_MULT };
+
+typedef struct s21_batch_kernels {
+  void (*det)(int n, const double *a, int stride, double *det, int lo,
+              int hi);
+  void (*inverse)(int n, const double *a, int stride, double *c, double *det,
+                  int lo, int hi);
+  void (*mult)(int m, int k, int n, const double *a, const double *b,
+               double *c, int stride, int lo, int hi);
+} s21_batch_kernels_t;
+
+typedef struct s21_batch_job {
+  const s21_batch_kernels_t *kernels;
+  int op;
+  batch_t *A;
+  batch_t *B;
+  batch_t *C;
+  double *det;
+} s21_batch_job_t;
+
+S21_INLINE void s21_batch_load(int count, const double *a, int stride,
+                               double m[16][S21_LANES]) {
+  for (int e = 0; e < count; e++) {
+    for (int l = 0; l < S21_LANES; l++) m[e][l] = a[(size_t)e * stride + l];
+  }
+}
+
+S21_INLINE void s21_batch_det_lanes(int n, const double *a, int stride,
+                                    double *det) {
+  double m[16][S21_LANES] = {{0}};
+  s21_batch_load(n * n, a, stride, m);
+  if (n == 1) {
+    for (int l = 0; l < S21_LANES; l++) det[l] = m[0][l];
+  } else if (n == 2) {
+    for (int l = 0; l < S21_LANES; l++) {
+      det[l] = m[0][l] * m[3][l] - m[2][l] * m[1][l];
+    }
+  } else if (n == 3) {
+    for (int l = 0; l < S21_LANES; l++) {
+      det[l] = m[0][l] * (m[4][l] * m[8][l] - m[7][l] * m[5][l]) -
+               m[1][l] * (m[3][l] * m[8][l] - m[6][l] * m[5][l]) +
+               m[2][l] * (m[3][l] * m[7][l] - m[6][l] * m[4][l]);
+    }
+  } else {
+    for (int l = 0; l < S21_LANES; l++) {
+      double s0 = m[0][l] * m[5][l] - m[4][l] * m[1][l];
+      double s1 = m[0][l] * m[6][l] - m[4][l] * m[2][l];
+      double s2 = m[0][l] * m[7][l] - m[4][l] * m[3][l];
+      double s3 = m[1][l] * m[6][l] - m[5][l] * m[2][l];
+      double s4 = m[1][l] * m[7][l] - m[5][l] * m[3][l];
+      double s5 = m[2][l] * m[7][l] - m[6][l] * m[3][l];
+      double c5 = m[10][l] * m[15][l] - m[14][l] * m[11][l];
+      double c4 = m[9][l] * m[15][l] - m[13][l] * m[11][l];
+      double c3 = m[9][l] * m[14][l] - m[13][l] * m[10][l];
+      double c2 = m[8][l] * m[15][l] - m[12][l] * m[11][l];
+      double c1 = m[8][l] * m[14][l] - m[12][l] * m[10][l];
+      double c0 = m[8][l] * m[13][l] - m[12][l] * m[9][l];
+      det[l] = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+    }
+  }
+}
+
+S21_INLINE void s21_batch_inverse_lanes(int n, const double *a, int stride,
+                                        double *c, double *det) {
+  double m[16][S21_LANES] = {{0}};
+  double r[16][S21_LANES];
+  double d[S21_LANES];
+  s21_batch_load(n * n, a, stride, m);
+  if (n == 1) {
+    for (int l = 0; l < S21_LANES; l++) {
+      d[l] = m[0][l];
+      r[0][l] = 1.0;
+    }
+  } else if (n == 2) {
+    for (int l = 0; l < S21_LANES; l++) {
+      d[l] = m[0][l] * m[3][l] - m[2][l] * m[1][l];
+      r[0][l] = m[3][l];
+      r[1][l] = -m[1][l];
+      r[2][l] = -m[2][l];
+      r[3][l] = m[0][l];
+    }
+  } else if (n == 3) {
+    for (int l = 0; l < S21_LANES; l++) {
+      r[0][l] = m[4][l] * m[8][l] - m[7][l] * m[5][l];
+      r[3][l] = m[6][l] * m[5][l] - m[3][l] * m[8][l];
+      r[6][l] = m[3][l] * m[7][l] - m[6][l] * m[4][l];
+      r[1][l] = m[7][l] * m[2][l] - m[1][l] * m[8][l];
+      r[4][l] = m[0][l] * m[8][l] - m[6][l] * m[2][l];
+      r[7][l] = m[6][l] * m[1][l] - m[0][l] * m[7][l];
+      r[2][l] = m[1][l] * m[5][l] - m[4][l] * m[2][l];
+      r[5][l] = m[3][l] * m[2][l] - m[0][l] * m[5][l];
+      r[8][l] = m[0][l] * m[4][l] - m[3][l] * m[1][l];
+      d[l] = m[0][l] * r[0][l] + m[1][l] * r[3][l] + m[2][l] * r[6][l];
+    }
+  } else {
+    for (int l = 0; l < S21_LANES; l++) {
+      double s0 = m[0][l] * m[5][l] - m[4][l] * m[1][l];
+      double s1 = m[0][l] * m[6][l] - m[4][l] * m[2][l];
+      double s2 = m[0][l] * m[7][l] - m[4][l] * m[3][l];
+      double s3 = m[1][l] * m[6][l] - m[5][l] * m[2][l];
+      double s4 = m[1][l] * m[7][l] - m[5][l] * m[3][l];
+      double s5 = m[2][l] * m[7][l] - m[6][l] * m[3][l];
+      double c5 = m[10][l] * m[15][l] - m[14][l] * m[11][l];
+      double c4 = m[9][l] * m[15][l] - m[13][l] * m[11][l];
+      double c3 = m[9][l] * m[14][l] - m[13][l] * m[10][l];
+      double c2 = m[8][l] * m[15][l] - m[12][l] * m[11][l];
+      double c1 = m[8][l] * m[14][l] - m[12][l] * m[10][l];
+      double c0 = m[8][l] * m[13][l] - m[12][l] * m[9][l];
+      d[l] = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+      r[0][l] = m[5][l] * c5 - m[6][l] * c4 + m[7][l] * c3;
+      r[1][l] = -m[1][l] * c5 + m[2][l] * c4 - m[3][l] * c3;
+      r[2][l] = m[13][l] * s5 - m[14][l] * s4 + m[15][l] * s3;
+      r[3][l] = -m[9][l] * s5 + m[10][l] * s4 - m[11][l] * s3;
+      r[4][l] = -m[4][l] * c5 + m[6][l] * c2 - m[7][l] * c1;
+      r[5][l] = m[0][l] * c5 - m[2][l] * c2 + m[3][l] * c1;
+      r[6][l] = -m[12][l] * s5 + m[14][l] * s2 - m[15][l] * s1;
+      r[7][l] = m[8][l] * s5 - m[10][l] * s2 + m[11][l] * s1;
+      r[8][l] = m[4][l] * c4 - m[5][l] * c2 + m[7][l] * c0;
+      r[9][l] = -m[0][l] * c4 + m[1][l] * c2 - m[3][l] * c0;
+      r[10][l] = m[12][l] * s4 - m[13][l] * s2 + m[15][l] * s0;
+      r[11][l] = -m[8][l] * s4 + m[9][l] * s2 - m[11][l] * s0;
+      r[12][l] = -m[4][l] * c3 + m[5][l] * c1 - m[6][l] * c0;
+      r[13][l] = m[0][l] * c3 - m[1][l] * c1 + m[2][l] * c0;
+      r[14][l] = -m[12][l] * s3 + m[13][l] * s1 - m[14][l] * s0;
+      r[15][l] = m[8][l] * s3 - m[9][l] * s1 + m[10][l] * s0;
+    }
+  }
+  for (int l = 0; l < S21_LANES; l++) {
+    double ok = d[l] != 0;
+    det[l] = d[l] * ok;
+    d[l] = ok / (d[l] + (1.0 - ok));
+  }
+  for (int e = 0; e < n * n; e++) {
+    double *ce = c + (size_t)e * stride;
+    for (int l = 0; l < S21_LANES; l++) ce[l] = r[e][l] * d[l];
+  }
+}
+
+S21_INLINE void s21_batch_mult_lanes(int m, int k, int n, const double *a,
+                                     const double *b, double *c,
+                                     int stride) {
+  for (int i = 0; i < m; i++) {
+    for (int j = 0; j < n; j++) {
+      double acc[S21_LANES] = {0};
+      for (int p = 0; p < k; p++) {
+        const double *ap = a + (size_t)(i * k + p) * stride;
+        const double *bp = b + (size_t)(p * n + j) * stride;
+        for (int l = 0; l < S21_LANES; l++) acc[l] += ap[l] * bp[l];
+      }
+      double *cp = c + (size_t)(i * n + j) * stride;
+      for (int l = 0; l < S21_LANES; l++) cp[l] = acc[l];
+    }
+  }
+}
+
+#define S21_BATCH_VARIANT(attr, suffix)                                      \
+  attr static void s21_batch_det_##suffix(int n, const double *a,           \
+                                          int stride, double *det, int lo,  \
+                                          int hi) {                         \
+    for (int b = lo; b < hi; b += S21_LANES) {                              \
+      s21_batch_det_lanes(n, a + b, stride, det + b);                       \
+    }                                                                       \
+  }                                                                         \
+  attr static void s21_batch_inverse_##suffix(int n, const double *a,       \
+                                              int stride, double *c,        \
+                                              double *det, int lo, int hi) {\
+    for (int b = lo; b < hi; b += S21_LANES) {                              \
+      s21_batch_inverse_lanes(n, a + b, stride, c + b, det + b);            \
+    }                                                                       \
+  }                                                                         \
+  attr static void s21_batch_mult_##suffix(int m, int k, int n,             \
+                                           const double *a, const double *b,\
+                                           double *c, int stride, int lo,   \
+                                           int hi) {                        \
+    for (int l = lo; l < hi; l += S21_LANES) {                              \
+      s21_batch_mult_lanes(m, k, n, a + l, b + l, c + l, stride);           \
+    }                                                                       \
+  }
+
+S21_BATCH_VARIANT(, generic)
+#ifdef S21_X86
+S21_BATCH_VARIANT(S21_AVX2, avx2)
+S21_BATCH_VARIANT(S21_AVX512, avx512)
+#endif
+
+static const s21_batch_kernels_t s21_batch_table[] = {
+    {s21_batch_det_generic, s21_batch_inverse_generic, s21_batch_mult_generic},
+#ifdef S21_X86
+    {s21_batch_det_generic, s21_batch_inverse_generic, s21_batch_mult_generic},
+    {s21_batch_det_avx2, s21_batch_inverse_avx2, s21_batch_mult_avx2},
+    {s21_batch_det_avx512, s21_batch_inverse_avx512, s21_batch_mult_avx512},
+#endif
+};
+
+static int s21_is_batch_ok(batch_t *A) {
+  return A != NULL && A->data != NULL && A->rows > 0 && A->columns > 0 &&
+         A->count > 0;
+}
+
+static double *s21_batch_at(batch_t *A, int i, int j) {
+  return A->data + ((size_t)i * A->columns + j) * A->stride;
+}
+
+int s21_create_batch(int rows, int columns, int count, batch_t *result) {
+  int err_code = INCORRECT_MATRIX;
+  if (result != NULL) {
+    memset(result, 0, sizeof(*result));
+    if (rows > 0 && columns > 0 && count > 0 && count <= INT_MAX - S21_LANES &&
+        (size_t)rows * columns <= SIZE_MAX / sizeof(double) / INT_MAX) {
+      int stride = (count + S21_LANES - 1) / S21_LANES * S21_LANES;
+      size_t size = (size_t)rows * columns * stride;
+      result->data = s21_alloc_block(size);
+      if (result->data != NULL) {
+        memset(result->data, 0, size * sizeof(double));
+        result->rows = rows;
+        result->columns = columns;
+        result->count = count;
+        result->stride = stride;
+        err_code = OK;
+      }
+    }
+  }
+  return err_code;
+}
+
+void s21_remove_batch(batch_t *A) {
+  if (A != NULL) {
+    free(A->data);
+    memset(A, 0, sizeof(*A));
+  }
+}
+
+int s21_batch_set(batch_t *A, int index, matrix_t *M) {
+  if (!s21_is_batch_ok(A) || !s21_is_matrix_ok(M)) return INCORRECT_MATRIX;
+  int err_code = CALCULATION_ERROR;
+  if (index >= 0 && index < A->count && M->rows == A->rows &&
+      M->columns == A->columns) {
+    for (int i = 0; i < A->rows; i++) {
+      for (int j = 0; j < A->columns; j++) {
+        s21_batch_at(A, i, j)[index] = *s21_at(M, i, j);
+      }
+    }
+    err_code = OK;
+  }
+  return err_code;
+}
+
+int s21_batch_get(batch_t *A, int index, matrix_t *result) {
+  if (!s21_is_batch_ok(A) || !s21_is_matrix_ok(result) ||
+      !s21_is_writable(result)) {
+    return INCORRECT_MATRIX;
+  }
+  int err_code = CALCULATION_ERROR;
+  if (index >= 0 && index < A->count && result->rows == A->rows &&
+      result->columns == A->columns) {
+    for (int i = 0; i < A->rows; i++) {
+      for (int j = 0; j < A->columns; j++) {
+        *s21_at(result, i, j) = s21_batch_at(A, i, j)[index];
+      }
+    }
+    err_code = OK;
+  }
+  return err_code;
+}
+
+int s21_batch_from_matrices(matrix_t *items, int count, batch_t *result) {
+  if (items == NULL || count < 1 || !s21_is_matrix_ok(&items[0])) {
+    return INCORRECT_MATRIX;
+  }
+  int err_code =
+      s21_create_batch(items[0].rows, items[0].columns, count, result);
+  for (int b = 0; b < count && err_code == OK; b++) {
+    err_code = s21_batch_set(result, b, &items[b]);
+  }
+  if (err_code != OK) s21_remove_batch(result);
+  return err_code;
+}
+
+int s21_batch_to_matrices(batch_t *A, matrix_t *result) {
+  if (!s21_is_batch_ok(A) || result == NULL) return INCORRECT_MATRIX;
+  int err_code = OK;
+  int created = 0;
+  for (; created < A->count && err_code == OK; created++) {
+    err_code = s21_create_matrix(A->rows, A->columns, &result[created]);
+    if (err_code == OK) err_code = s21_batch_get(A, created, &result[created]);
+  }
+  if (err_code != OK) {
+    for (int b = 0; b < created; b++) s21_remove_matrix(&result[b]);
+  }
+  return err_code;
+}
+
+static void s21_batch_task(void *ctx, int task) {
+  s21_batch_job_t *job = (s21_batch_job_t *)ctx;
+  batch_t *A = job->A;
+  int lo = task * S21_BATCH_TASK;
+  int hi = lo + S21_BATCH_TASK < A->stride ? lo + S21_BATCH_TASK : A->stride;
+  if (job->op == S21_BATCH_DET) {
+    job->kernels->det(A->rows, A->data, A->stride, job->det, lo, hi);
+  } else if (job->op == S21_BATCH_INVERSE) {
+    job->kernels->inverse(A->rows, A->data, A->stride, job->C->data,
+                          job->det, lo, hi);
+  } else {
+    job->kernels->mult(A->rows, A->columns, job->B->columns, A->data,
+                       job->B->data, job->C->data, A->stride, lo, hi);
+  }
+}
+
+static void s21_batch_run(s21_batch_job_t *job, double work) {
+  int tasks = (job->A->stride + S21_BATCH_TASK - 1) / S21_BATCH_TASK;
+  job->kernels = &s21_batch_table[s21_simd_level()];
+  if (tasks > 1 && s21_parallel_workers(work * job->A->count) > 1) {
+    s21_parallel_for(tasks, s21_batch_task, job);
+  } else {
+    for (int task = 0; task < tasks; task++) s21_batch_task(job, task);
+  }
+}
+
+static int s21_batch_generic(int op, batch_t *A, batch_t *C, double *det) {
+  matrix_t M = {0};
+  matrix_t R = {0};
+  int n = A->rows;
+  int err_code = s21_create_matrix(n, n, &M);
+  if (err_code == OK) err_code = s21_create_matrix(n, n, &R);
+  for (int b = 0; b < A->count && err_code == OK; b++) {
+    s21_batch_get(A, b, &M);
+    if (op == S21_BATCH_DET) {
+      s21_determinant(&M, &det[b]);
+    } else if (s21_inverse_matrix_into(&M, &R) == OK) {
+      det[b] = 1.0;
+      s21_batch_set(C, b, &R);
+    } else {
+      det[b] = 0.0;
+    }
+  }
+  s21_remove_matrix(&M);
+  s21_remove_matrix(&R);
+  return err_code;
+}
+
+int s21_batch_determinant(batch_t *A, double *result) {
+  if (!s21_is_batch_ok(A) || result == NULL) return INCORRECT_MATRIX;
+  int err_code = CALCULATION_ERROR;
+  if (A->rows == A->columns && A->rows > 4) {
+    err_code = s21_batch_generic(S21_BATCH_DET, A, NULL, result);
+  } else if (A->rows == A->columns) {
+    double *det = s21_alloc_block(A->stride);
+    err_code = det != NULL ? OK : INCORRECT_MATRIX;
+    if (err_code == OK) {
+      s21_batch_job_t job = {NULL, S21_BATCH_DET, A, NULL, NULL, det};
+      s21_batch_run(&job, 64.0);
+      memcpy(result, det, A->count * sizeof(double));
+    }
+    free(det);
+  }
+  return err_code;
+}
+
+int s21_batch_inverse(batch_t *A, batch_t *result) {
+  if (!s21_is_batch_ok(A) || result == NULL) return INCORRECT_MATRIX;
+  if (A->rows != A->columns) return CALCULATION_ERROR;
+  int err_code = s21_create_batch(A->rows, A->columns, A->count, result);
+  double *det = s21_alloc_block(A->stride);
+  if (err_code == OK && det == NULL) err_code = INCORRECT_MATRIX;
+  if (err_code == OK && A->rows > 4) {
+    err_code = s21_batch_generic(S21_BATCH_INVERSE, A, result, det);
+  } else if (err_code == OK) {
+    s21_batch_job_t job = {NULL, S21_BATCH_INVERSE, A, NULL, result, det};
+    s21_batch_run(&job, 256.0);
+  }
+  for (int b = 0; b < A->count && err_code == OK; b++) {
+    if (det[b] == 0.0) err_code = CALCULATION_ERROR;
+  }
+  if (err_code != OK) s21_remove_batch(result);
+  free(det);
+  return err_code;
+}
+
+int s21_batch_mult(batch_t *A, batch_t *B, batch_t *result) {
+  if (!s21_is_batch_ok(A) || !s21_is_batch_ok(B) || result == NULL) {
+    return INCORRECT_MATRIX;
+  }
+  if (A->columns != B->rows || A->count != B->count) {
+    return CALCULATION_ERROR;
+  }
+  int err_code = s21_create_batch(A->rows, B->columns, A->count, result);
+  if (err_code == OK) {
+    s21_batch_job_t job = {NULL, S21_BATCH_MULT, A, B, result, NULL};
+    s21_batch_run(&job, 2.0 * A->rows * A->columns * B->columns);
+  }
+  return err_code;
+}
+
+int s21_batch_transpose(batch_t *A, batch_t *result) {
+  if (!s21_is_batch_ok(A) || result == NULL) return INCORRECT_MATRIX;
+  int err_code = s21_create_batch(A->columns, A->rows, A->count, result);
+  for (int i = 0; i < A->rows && err_code == OK; i++) {
+    for (int j = 0; j < A->columns; j++) {
+      memcpy(s21_batch_at(result, j, i), s21_batch_at(A, i, j),
+             A->stride * sizeof(double));
+    }
+  }
+  return err_code;
+}
@@ -0,0 +1,229 @@
+#include <float.h>
+#include <string.h>
+
+#include "s21_internal.h"
+
+typedef struct s21_chol_job {
+  double **a;
+  int n, k0, k1;
+  int rows_per_task;
+} s21_chol_job_t;
+
+static int s21_chol_diag(double **a, int k0, int k1, double tol) {
+  int err_code = OK;
+  for (int j = k0; j < k1 && err_code == OK; j++) {
+    const double *row_j = a[j];
+    double d = row_j[j];
+    for (int p = k0; p < j; p++) d -= row_j[p] * row_j[p];
+    if (d > tol) {
+      double l = sqrt(d);
+      a[j][j] = l;
+      for (int i = j + 1; i < k1; i++) {
+        double *row_i = a[i];
+        double s = row_i[j];
+        for (int p = k0; p < j; p++) s -= row_i[p] * row_j[p];
+        row_i[j] = s / l;
+      }
+    } else {
+      err_code = CALCULATION_ERROR;
+    }
+  }
+  return err_code;
+}
+
+static void s21_chol_panel(void *ctx, int task) {
+  const s21_chol_job_t *job = (const s21_chol_job_t *)ctx;
+  int lo = job->k1 + task * job->rows_per_task;
+  int hi = job->n - lo < job->rows_per_task ? job->n : lo + job->rows_per_task;
+  for (int i = lo; i < hi; i++) {
+    double *row_i = job->a[i];
+    for (int j = job->k0; j < job->k1; j++) {
+      const double *row_j = job->a[j];
+      double s = row_i[j];
+      for (int p = job->k0; p < j; p++) s -= row_i[p] * row_j[p];
+      row_i[j] = s / row_j[j];
+    }
+  }
+}
+
+int s21_chol_factor(double **a, int n, double tol) {
+  int err_code = OK;
+  for (int k0 = 0; k0 < n && err_code == OK; k0 += S21_LU_BLOCK) {
+    int k1 = n - k0 < S21_LU_BLOCK ? n : k0 + S21_LU_BLOCK;
+    err_code = s21_chol_diag(a, k0, k1, tol);
+    if (err_code == OK && k1 < n) {
+      s21_chol_job_t job = {a, n, k0, k1, n - k1};
+      int workers = s21_parallel_workers((double)(n - k1) * (k1 - k0) * n);
+      if (workers > 1) {
+        job.rows_per_task = (n - k1 + 4 * workers - 1) / (4 * workers);
+      }
+      int tasks = (n - k1 + job.rows_per_task - 1) / job.rows_per_task;
+      s21_parallel_for(tasks, s21_chol_panel, &job);
+      for (int j0 = k1; j0 < n; j0 += S21_LU_BLOCK) {
+        int jn = n - j0 < S21_LU_BLOCK ? n - j0 : S21_LU_BLOCK;
+        s21_dgemm(S21_NO_TRANS, S21_TRANS, n - j0, jn, k1 - k0, -1.0, a + j0,
+                  k0, a + j0, k0, 1.0, a + j0, j0);
+      }
+    }
+  }
+  return err_code;
+}
+
+double s21_chol_tolerance(matrix_t *A) {
+  double max_diag = 0;
+  for (int i = 0; i < A->rows && i < A->columns; i++) {
+    if (A->matrix[i][i] > max_diag) max_diag = A->matrix[i][i];
+  }
+  return s21_lu_tolerance(A->rows, max_diag);
+}
+
+static int s21_is_symmetric(matrix_t *A, double tol) {
+  int symmetric = 1;
+  int n = A->rows;
+  for (int i0 = 0; i0 < n && symmetric; i0 += S21_TRANSPOSE_LEAF) {
+    int i1 = n - i0 < S21_TRANSPOSE_LEAF ? n : i0 + S21_TRANSPOSE_LEAF;
+    for (int j0 = 0; j0 <= i0 && symmetric; j0 += S21_TRANSPOSE_LEAF) {
+      for (int i = i0; i < i1 && symmetric; i++) {
+        int j1 = j0 + S21_TRANSPOSE_LEAF < i ? j0 + S21_TRANSPOSE_LEAF : i;
+        for (int j = j0; j < j1 && symmetric; j++) {
+          symmetric = fabs(A->matrix[i][j] - A->matrix[j][i]) <= tol;
+        }
+      }
+    }
+  }
+  return symmetric;
+}
+
+static int s21_is_spd_input(matrix_t *A, double tol) {
+  int candidate = A->rows == A->columns;
+  for (int i = 0; i < A->rows && candidate; i++) {
+    candidate = A->matrix[i][i] > 0;
+  }
+  return candidate && s21_is_symmetric(A, tol);
+}
+
+int s21_chol_candidate(matrix_t *A) { return s21_is_spd_input(A, 0.0); }
+
+static int s21_chol_open(matrix_t *A, s21_scratch_t *scratch, int copies,
+                         matrix_t *L) {
+  int n = A->rows;
+  int err_code = s21_scratch_open(scratch, copies * s21_matrix_bytes(n, n));
+  if (err_code == OK) {
+    s21_create_matrix_arena(n, n, scratch->arena, L);
+    s21_copy_matrix(A, L);
+    err_code = s21_chol_factor(L->matrix, n, s21_chol_tolerance(A));
+  }
+  return err_code;
+}
+
+int s21_chol_det(matrix_t *A, double *result) {
+  s21_scratch_t scratch;
+  matrix_t L = {0};
+  int err_code = s21_chol_open(A, &scratch, 1, &L);
+  if (err_code == OK) {
+    double det = 1.0;
+    for (int i = 0; i < A->rows; i++) det *= L.matrix[i][i] * L.matrix[i][i];
+    *result = det;
+  }
+  s21_scratch_close(&scratch);
+  return err_code;
+}
+
+void s21_chol_invert(double **l, int n, double **w, double **result) {
+  for (int i = 0; i < n; i++) {
+    memset(w[i], 0, n * sizeof(double));
+    w[i][i] = 1.0;
+  }
+  for (int j0 = 0; j0 < n; j0 += S21_LU_BLOCK) {
+    int jn = n - j0 < S21_LU_BLOCK ? n - j0 : S21_LU_BLOCK;
+    s21_trsm(S21_LOWER, S21_NO_TRANS, 0, n - j0, l + j0, j0, jn, w + j0, j0);
+  }
+  for (int i0 = 0; i0 < n; i0 += S21_LU_BLOCK) {
+    int in = n - i0 < S21_LU_BLOCK ? n - i0 : S21_LU_BLOCK;
+    for (int j0 = 0; j0 <= i0; j0 += S21_LU_BLOCK) {
+      int jn = n - j0 < S21_LU_BLOCK ? n - j0 : S21_LU_BLOCK;
+      s21_dgemm(S21_TRANS, S21_NO_TRANS, in, jn, n - i0, 1.0, w + i0, i0,
+                w + i0, j0, 0.0, result + i0, j0);
+    }
+  }
+  for (int i = 0; i < n; i++) {
+    for (int j = i + 1; j < n; j++) result[i][j] = result[j][i];
+  }
+}
+
+int s21_chol_inverse(matrix_t *A, matrix_t *result) {
+  int n = A->rows;
+  s21_scratch_t scratch;
+  matrix_t L = {0};
+  int err_code = s21_chol_open(A, &scratch, 2, &L);
+  if (err_code == OK) {
+    matrix_t W = {0};
+    s21_create_matrix_arena(n, n, scratch.arena, &W);
+    s21_chol_invert(L.matrix, n, W.matrix, result->matrix);
+  }
+  s21_scratch_close(&scratch);
+  return err_code;
+}
+
+int s21_cholesky(matrix_t *A, matrix_t *result) {
+  if (!s21_is_matrix_ok(A)) return INCORRECT_MATRIX;
+  int err_code = CALCULATION_ERROR;
+  if (s21_is_spd_input(A, s21_chol_tolerance(A))) {
+    err_code = s21_create_matrix(A->rows, A->columns, result);
+  }
+  if (err_code == OK) {
+    int n = A->rows;
+    s21_copy_matrix(A, result);
+    err_code = s21_chol_factor(result->matrix, n, s21_chol_tolerance(A));
+    for (int i = 0; i < n && err_code == OK; i++) {
+      memset(result->matrix[i] + i + 1, 0, (n - i - 1) * sizeof(double));
+    }
+    if (err_code != OK) s21_remove_matrix(result);
+  }
+  return err_code;
+}
+
+int s21_cholesky_determinant(matrix_t *A, double *result) {
+  if (!s21_is_matrix_ok(A) || result == NULL) return INCORRECT_MATRIX;
+  int err_code = CALCULATION_ERROR;
+  if (s21_is_spd_input(A, s21_chol_tolerance(A))) {
+    err_code = s21_chol_det(A, result);
+  }
+  return err_code;
+}
+
+int s21_cholesky_solve(matrix_t *A, matrix_t *B, matrix_t *result) {
+  if (!s21_is_matrix_ok(A) || !s21_is_matrix_ok(B)) return INCORRECT_MATRIX;
+  int err_code = CALCULATION_ERROR;
+  if (B->rows == A->rows && s21_is_spd_input(A, s21_chol_tolerance(A))) {
+    err_code = s21_materialize(B, result);
+  }
+  if (err_code == OK) {
+    s21_scratch_t scratch;
+    matrix_t L = {0};
+    int n = A->rows;
+    err_code = s21_chol_open(A, &scratch, 1, &L);
+    if (err_code == OK) {
+      s21_trsm(S21_LOWER, S21_NO_TRANS, 0, n, L.matrix, 0, B->columns,
+               result->matrix, 0);
+      s21_trsm(S21_LOWER, S21_TRANS, 0, n, L.matrix, 0, B->columns,
+               result->matrix, 0);
+    }
+    s21_scratch_close(&scratch);
+    if (err_code != OK) s21_remove_matrix(result);
+  }
+  return err_code;
+}
+
+int s21_cholesky_inverse(matrix_t *A, matrix_t *result) {
+  if (!s21_is_matrix_ok(A)) return INCORRECT_MATRIX;
+  int err_code = CALCULATION_ERROR;
+  if (s21_is_spd_input(A, s21_chol_tolerance(A))) {
+    err_code = s21_create_matrix(A->rows, A->columns, result);
+  }
+  if (err_code == OK) {
+    err_code = s21_chol_inverse(A, result);
+    if (err_code != OK) s21_remove_matrix(result);
+  }
+  return err_code;
+}
@@ -0,0 +1,163 @@
+#include <string.h>
+
+#include "s21_internal.h"
+
+static int s21_factor_refresh(factor_t *F) {
+  matrix_t *A = F->source;
+  int n = F->lu.rows;
+  int err_code = OK;
+  if (!s21_is_matrix_ok(A)) {
+    err_code = INCORRECT_MATRIX;
+  } else if (A->rows != n || A->columns != n) {
+    err_code = CALCULATION_ERROR;
+  } else {
+    s21_copy_logical(A, &F->lu);
+    F->kind = S21_FACTOR_LU;
+    F->sign = 1;
+    F->rank = n;
+    if (s21_chol_candidate(A)) {
+      if (s21_chol_factor(F->lu.matrix, n, s21_chol_tolerance(A)) == OK) {
+        F->kind = S21_FACTOR_CHOLESKY;
+      } else {
+        s21_copy_logical(A, &F->lu);
+      }
+    }
+    if (F->kind == S21_FACTOR_LU) {
+      F->sign = s21_lu_factor(F->lu.matrix, n, F->pivots);
+      F->rank = s21_lu_rank(F->lu.matrix, n);
+    }
+    if (F->rank < n) {
+      int *pcol = F->pivots + n;
+      s21_copy_logical(A, &F->lu);
+      s21_lu_full(F->lu.matrix, n, F->pivots, pcol);
+      F->kind = S21_FACTOR_LU_FULL;
+      F->sign = s21_lu_parity(F->pivots, n) * s21_lu_parity(pcol, n);
+      F->rank = s21_lu_rank(F->lu.matrix, n);
+    }
+  }
+  F->valid = err_code == OK;
+  return err_code;
+}
+
+static int s21_factor_ready(factor_t *F) {
+  int err_code = OK;
+  if (F == NULL || F->lu.matrix == NULL || F->pivots == NULL) {
+    err_code = INCORRECT_MATRIX;
+  } else if (!F->valid) {
+    err_code = s21_factor_refresh(F);
+  }
+  return err_code;
+}
+
+static int s21_factor_is_singular(factor_t *F) {
+  return F->rank < F->lu.rows;
+}
+
+int s21_factorize(matrix_t *A, factor_t *result) {
+  if (!s21_is_matrix_ok(A) || result == NULL) return INCORRECT_MATRIX;
+  int err_code = CALCULATION_ERROR;
+  *result = (factor_t){0};
+  if (A->rows == A->columns) {
+    err_code = s21_create_matrix(A->rows, A->columns, &result->lu);
+  }
+  if (err_code == OK) {
+    result->pivots = (int *)malloc(2 * A->rows * sizeof(int));
+    result->source = A;
+    err_code = result->pivots != NULL ? s21_factor_refresh(result)
+                                      : INCORRECT_MATRIX;
+    if (err_code != OK) s21_remove_factor(result);
+  }
+  return err_code;
+}
+
+void s21_remove_factor(factor_t *F) {
+  if (F != NULL) {
+    s21_remove_matrix(&F->lu);
+    free(F->pivots);
+    *F = (factor_t){0};
+  }
+}
+
+void s21_invalidate_factor(factor_t *F) {
+  if (F != NULL) F->valid = 0;
+}
+
+int s21_factor_determinant(factor_t *F, double *result) {
+  int err_code = result != NULL ? s21_factor_ready(F) : INCORRECT_MATRIX;
+  if (err_code == OK) {
+    int n = F->lu.rows;
+    double **a = F->lu.matrix;
+    if (F->kind == S21_FACTOR_CHOLESKY) {
+      double det = 1.0;
+      for (int i = 0; i < n; i++) det *= a[i][i] * a[i][i];
+      *result = det;
+    } else {
+      *result = s21_lu_det(a, n, F->sign);
+    }
+  }
+  return err_code;
+}
+
+int s21_factor_inverse(factor_t *F, matrix_t *result) {
+  int err_code = s21_factor_ready(F);
+  if (err_code == OK && s21_factor_is_singular(F)) err_code = CALCULATION_ERROR;
+  if (err_code == OK) {
+    int n = F->lu.rows;
+    err_code = s21_create_matrix(n, n, result);
+    if (err_code == OK && F->kind == S21_FACTOR_CHOLESKY) {
+      s21_scratch_t scratch;
+      err_code = s21_scratch_open(&scratch, s21_matrix_bytes(n, n));
+      if (err_code == OK) {
+        matrix_t W = {0};
+        s21_create_matrix_arena(n, n, scratch.arena, &W);
+        s21_chol_invert(F->lu.matrix, n, W.matrix, result->matrix);
+      }
+      s21_scratch_close(&scratch);
+      if (err_code != OK) s21_remove_matrix(result);
+    } else if (err_code == OK) {
+      s21_lu_inverse(F->lu.matrix, F->pivots, n, result->matrix);
+      if (F->kind == S21_FACTOR_LU_FULL) {
+        s21_lu_permute_back(F->pivots + n, n, result->matrix, n);
+      }
+    }
+  }
+  return err_code;
+}
+
+int s21_factor_solve(factor_t *F, matrix_t *B, matrix_t *result) {
+  int err_code = s21_is_matrix_ok(B) ? s21_factor_ready(F) : INCORRECT_MATRIX;
+  if (err_code == OK &&
+      (B->rows != F->lu.rows || s21_factor_is_singular(F))) {
+    err_code = CALCULATION_ERROR;
+  }
+  if (err_code == OK) err_code = s21_materialize(B, result);
+  if (err_code == OK) {
+    int n = F->lu.rows;
+    double **a = F->lu.matrix;
+    if (F->kind == S21_FACTOR_CHOLESKY) {
+      s21_trsm(S21_LOWER, S21_NO_TRANS, 0, n, a, 0, B->columns, result->matrix,
+               0);
+      s21_trsm(S21_LOWER, S21_TRANS, 0, n, a, 0, B->columns, result->matrix,
+               0);
+    } else {
+      s21_lu_permute(F->pivots, n, result->matrix, B->columns);
+      s21_lu_solve(a, n, result->matrix, B->columns);
+      if (F->kind == S21_FACTOR_LU_FULL) {
+        s21_lu_permute_back(F->pivots + n, n, result->matrix, B->columns);
+      }
+    }
+  }
+  return err_code;
+}
+
+int s21_factor_rank(factor_t *F, int *result) {
+  int err_code = result != NULL ? s21_factor_ready(F) : INCORRECT_MATRIX;
+  if (err_code == OK) *result = F->rank;
+  return err_code;
+}
+
+int s21_factor_singular(factor_t *F, int *result) {
+  int err_code = result != NULL ? s21_factor_ready(F) : INCORRECT_MATRIX;
+  if (err_code == OK) *result = s21_factor_is_singular(F);
+  return err_code;
+}
@@ -0,0 +1,708 @@
+#include <limits.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "s21_internal.h"
+
+#ifdef S21_X86
+#include <immintrin.h>
+#endif
+
+#define S21_INLINE static inline __attribute__((always_inline))
+#define S21_FLANES 16
+
+typedef float s21_vec16f __attribute__((vector_size(64)));
+typedef double s21_vec16d __attribute__((vector_size(128)));
+typedef int s21_vec16i __attribute__((vector_size(64)));
+
+typedef void (*s21_smicro_fn)(int kc, const float *a, const float *b,
+                              float *ab);
+
+typedef struct s21_float_kernels {
+  void (*add)(int n, const float *a, const float *b, float *out);
+  void (*sub)(int n, const float *a, const float *b, float *out);
+  void (*scale)(int n, const float *a, float k, float *out);
+  int (*eq)(int n, const float *a, const float *b, float tol);
+  void (*narrow)(int n, const double *a, float *out);
+  void (*widen)(int n, const float *a, double *out);
+  s21_smicro_fn micro;
+} s21_float_kernels_t;
+
+typedef struct s21_sgemm_job {
+  const s21_float_kernels_t *kernels;
+  int m, n, k;
+  int rows_per_task;
+  float *const *a;
+  float *const *b;
+  float **c;
+} s21_sgemm_job_t;
+
+S21_INLINE void s21_add_f_lanes(int n, const float *a, const float *b,
+                                float *out) {
+  int j = 0;
+  for (; j + S21_FLANES <= n; j += S21_FLANES) {
+    s21_vec16f x, y;
+    memcpy(&x, a + j, sizeof(x));
+    memcpy(&y, b + j, sizeof(y));
+    x += y;
+    memcpy(out + j, &x, sizeof(x));
+  }
+  for (; j < n; j++) out[j] = a[j] + b[j];
+}
+
+S21_INLINE void s21_sub_f_lanes(int n, const float *a, const float *b,
+                                float *out) {
+  int j = 0;
+  for (; j + S21_FLANES <= n; j += S21_FLANES) {
+    s21_vec16f x, y;
+    memcpy(&x, a + j, sizeof(x));
+    memcpy(&y, b + j, sizeof(y));
+    x -= y;
+    memcpy(out + j, &x, sizeof(x));
+  }
+  for (; j < n; j++) out[j] = a[j] - b[j];
+}
+
+S21_INLINE void s21_scale_f_lanes(int n, const float *a, float k,
+                                  float *out) {
+  int j = 0;
+  for (; j + S21_FLANES <= n; j += S21_FLANES) {
+    s21_vec16f x;
+    memcpy(&x, a + j, sizeof(x));
+    x *= k;
+    memcpy(out + j, &x, sizeof(x));
+  }
+  for (; j < n; j++) out[j] = a[j] * k;
+}
+
+S21_INLINE int s21_eq_f_lanes(int n, const float *a, const float *b,
+                              float tol) {
+  s21_vec16f limit = (s21_vec16f){0} + tol;
+  s21_vec16i differ = {0};
+  int j = 0;
+  for (; j + S21_FLANES <= n; j += S21_FLANES) {
+    s21_vec16f x, y;
+    memcpy(&x, a + j, sizeof(x));
+    memcpy(&y, b + j, sizeof(y));
+    x -= y;
+    differ |= (x > limit) | (-x > limit);
+  }
+  int equal = SUCCESS;
+  for (int l = 0; l < S21_FLANES; l++) {
+    if (differ[l]) equal = FAILURE;
+  }
+  for (; j < n && equal; j++) {
+    if (fabsf(a[j] - b[j]) > tol) equal = FAILURE;
+  }
+  return equal;
+}
+
+S21_INLINE void s21_narrow_lanes(int n, const double *a, float *out) {
+  int j = 0;
+  for (; j + S21_FLANES <= n; j += S21_FLANES) {
+    s21_vec16d x;
+    memcpy(&x, a + j, sizeof(x));
+    s21_vec16f y = __builtin_convertvector(x, s21_vec16f);
+    memcpy(out + j, &y, sizeof(y));
+  }
+  for (; j < n; j++) out[j] = (float)a[j];
+}
+
+S21_INLINE void s21_widen_lanes(int n, const float *a, double *out) {
+  int j = 0;
+  for (; j + S21_FLANES <= n; j += S21_FLANES) {
+    s21_vec16f x;
+    memcpy(&x, a + j, sizeof(x));
+    s21_vec16d y = __builtin_convertvector(x, s21_vec16d);
+    memcpy(out + j, &y, sizeof(y));
+  }
+  for (; j < n; j++) out[j] = a[j];
+}
+
+#define S21_FLOAT_VARIANT(attr, suffix)                                      \
+  attr static void s21_add_f_##suffix(int n, const float *a, const float *b, \
+                                      float *out) {                          \
+    s21_add_f_lanes(n, a, b, out);                                           \
+  }                                                                          \
+  attr static void s21_sub_f_##suffix(int n, const float *a, const float *b, \
+                                      float *out) {                          \
+    s21_sub_f_lanes(n, a, b, out);                                           \
+  }                                                                          \
+  attr static void s21_scale_f_##suffix(int n, const float *a, float k,      \
+                                        float *out) {                        \
+    s21_scale_f_lanes(n, a, k, out);                                         \
+  }                                                                          \
+  attr static int s21_eq_f_##suffix(int n, const float *a, const float *b,   \
+                                    float tol) {                             \
+    return s21_eq_f_lanes(n, a, b, tol);                                     \
+  }                                                                          \
+  attr static void s21_narrow_##suffix(int n, const double *a, float *out) { \
+    s21_narrow_lanes(n, a, out);                                             \
+  }                                                                          \
+  attr static void s21_widen_##suffix(int n, const float *a, double *out) {  \
+    s21_widen_lanes(n, a, out);                                              \
+  }
+
+S21_FLOAT_VARIANT(, generic)
+#ifdef S21_X86
+S21_FLOAT_VARIANT(S21_AVX2, avx2)
+S21_FLOAT_VARIANT(S21_AVX512, avx512)
+#endif
+
+static void s21_smicro_generic(int kc, const float *a, const float *b,
+                               float *ab) {
+  float acc[S21_SGEMM_MR][S21_SGEMM_NR] = {{0}};
+  for (int p = 0; p < kc; p++) {
+    const float *ap = a + p * S21_SGEMM_MR;
+    const float *bp = b + p * S21_SGEMM_NR;
+    for (int i = 0; i < S21_SGEMM_MR; i++) {
+      for (int j = 0; j < S21_SGEMM_NR; j++) acc[i][j] += ap[i] * bp[j];
+    }
+  }
+  memcpy(ab, acc, sizeof(acc));
+}
+
+#ifdef S21_X86
+S21_AVX2 static void s21_smicro_avx2(int kc, const float *a, const float *b,
+                                     float *ab) {
+  __m256 c00 = _mm256_setzero_ps(), c01 = _mm256_setzero_ps();
+  __m256 c10 = _mm256_setzero_ps(), c11 = _mm256_setzero_ps();
+  __m256 c20 = _mm256_setzero_ps(), c21 = _mm256_setzero_ps();
+  __m256 c30 = _mm256_setzero_ps(), c31 = _mm256_setzero_ps();
+  __m256 c40 = _mm256_setzero_ps(), c41 = _mm256_setzero_ps();
+  __m256 c50 = _mm256_setzero_ps(), c51 = _mm256_setzero_ps();
+  for (int p = 0; p < kc; p++) {
+    const float *ap = a + p * S21_SGEMM_MR;
+    __m256 b0 = _mm256_load_ps(b + p * S21_SGEMM_NR);
+    __m256 b1 = _mm256_load_ps(b + p * S21_SGEMM_NR + 8);
+    __m256 x = _mm256_broadcast_ss(ap);
+    c00 = _mm256_fmadd_ps(x, b0, c00);
+    c01 = _mm256_fmadd_ps(x, b1, c01);
+    x = _mm256_broadcast_ss(ap + 1);
+    c10 = _mm256_fmadd_ps(x, b0, c10);
+    c11 = _mm256_fmadd_ps(x, b1, c11);
+    x = _mm256_broadcast_ss(ap + 2);
+    c20 = _mm256_fmadd_ps(x, b0, c20);
+    c21 = _mm256_fmadd_ps(x, b1, c21);
+    x = _mm256_broadcast_ss(ap + 3);
+    c30 = _mm256_fmadd_ps(x, b0, c30);
+    c31 = _mm256_fmadd_ps(x, b1, c31);
+    x = _mm256_broadcast_ss(ap + 4);
+    c40 = _mm256_fmadd_ps(x, b0, c40);
+    c41 = _mm256_fmadd_ps(x, b1, c41);
+    x = _mm256_broadcast_ss(ap + 5);
+    c50 = _mm256_fmadd_ps(x, b0, c50);
+    c51 = _mm256_fmadd_ps(x, b1, c51);
+  }
+  _mm256_store_ps(ab, c00);
+  _mm256_store_ps(ab + 8, c01);
+  _mm256_store_ps(ab + 16, c10);
+  _mm256_store_ps(ab + 24, c11);
+  _mm256_store_ps(ab + 32, c20);
+  _mm256_store_ps(ab + 40, c21);
+  _mm256_store_ps(ab + 48, c30);
+  _mm256_store_ps(ab + 56, c31);
+  _mm256_store_ps(ab + 64, c40);
+  _mm256_store_ps(ab + 72, c41);
+  _mm256_store_ps(ab + 80, c50);
+  _mm256_store_ps(ab + 88, c51);
+}
+
+S21_AVX512 static void s21_smicro_avx512(int kc, const float *a,
+                                         const float *b, float *ab) {
+  __m512 c0 = _mm512_setzero_ps(), c1 = _mm512_setzero_ps();
+  __m512 c2 = _mm512_setzero_ps(), c3 = _mm512_setzero_ps();
+  __m512 c4 = _mm512_setzero_ps(), c5 = _mm512_setzero_ps();
+  __m512 d0 = _mm512_setzero_ps(), d1 = _mm512_setzero_ps();
+  __m512 d2 = _mm512_setzero_ps(), d3 = _mm512_setzero_ps();
+  __m512 d4 = _mm512_setzero_ps(), d5 = _mm512_setzero_ps();
+  int p = 0;
+  for (; p + 2 <= kc; p += 2) {
+    const float *ap = a + p * S21_SGEMM_MR;
+    __m512 b0 = _mm512_load_ps(b + p * S21_SGEMM_NR);
+    __m512 b1 = _mm512_load_ps(b + (p + 1) * S21_SGEMM_NR);
+    c0 = _mm512_fmadd_ps(_mm512_set1_ps(ap[0]), b0, c0);
+    c1 = _mm512_fmadd_ps(_mm512_set1_ps(ap[1]), b0, c1);
+    c2 = _mm512_fmadd_ps(_mm512_set1_ps(ap[2]), b0, c2);
+    c3 = _mm512_fmadd_ps(_mm512_set1_ps(ap[3]), b0, c3);
+    c4 = _mm512_fmadd_ps(_mm512_set1_ps(ap[4]), b0, c4);
+    c5 = _mm512_fmadd_ps(_mm512_set1_ps(ap[5]), b0, c5);
+    d0 = _mm512_fmadd_ps(_mm512_set1_ps(ap[6]), b1, d0);
+    d1 = _mm512_fmadd_ps(_mm512_set1_ps(ap[7]), b1, d1);
+    d2 = _mm512_fmadd_ps(_mm512_set1_ps(ap[8]), b1, d2);
+    d3 = _mm512_fmadd_ps(_mm512_set1_ps(ap[9]), b1, d3);
+    d4 = _mm512_fmadd_ps(_mm512_set1_ps(ap[10]), b1, d4);
+    d5 = _mm512_fmadd_ps(_mm512_set1_ps(ap[11]), b1, d5);
+  }
+  if (p < kc) {
+    const float *ap = a + p * S21_SGEMM_MR;
+    __m512 b0 = _mm512_load_ps(b + p * S21_SGEMM_NR);
+    c0 = _mm512_fmadd_ps(_mm512_set1_ps(ap[0]), b0, c0);
+    c1 = _mm512_fmadd_ps(_mm512_set1_ps(ap[1]), b0, c1);
+    c2 = _mm512_fmadd_ps(_mm512_set1_ps(ap[2]), b0, c2);
+    c3 = _mm512_fmadd_ps(_mm512_set1_ps(ap[3]), b0, c3);
+    c4 = _mm512_fmadd_ps(_mm512_set1_ps(ap[4]), b0, c4);
+    c5 = _mm512_fmadd_ps(_mm512_set1_ps(ap[5]), b0, c5);
+  }
+  _mm512_store_ps(ab, _mm512_add_ps(c0, d0));
+  _mm512_store_ps(ab + 16, _mm512_add_ps(c1, d1));
+  _mm512_store_ps(ab + 32, _mm512_add_ps(c2, d2));
+  _mm512_store_ps(ab + 48, _mm512_add_ps(c3, d3));
+  _mm512_store_ps(ab + 64, _mm512_add_ps(c4, d4));
+  _mm512_store_ps(ab + 80, _mm512_add_ps(c5, d5));
+}
+#endif
+
+static const s21_float_kernels_t s21_float_table[] = {
+    {s21_add_f_generic, s21_sub_f_generic, s21_scale_f_generic,
+     s21_eq_f_generic, s21_narrow_generic, s21_widen_generic,
+     s21_smicro_generic},
+#ifdef S21_X86
+    {s21_add_f_generic, s21_sub_f_generic, s21_scale_f_generic,
+     s21_eq_f_generic, s21_narrow_generic, s21_widen_generic,
+     s21_smicro_generic},
+    {s21_add_f_avx2, s21_sub_f_avx2, s21_scale_f_avx2, s21_eq_f_avx2,
+     s21_narrow_avx2, s21_widen_avx2, s21_smicro_avx2},
+    {s21_add_f_avx512, s21_sub_f_avx512, s21_scale_f_avx512, s21_eq_f_avx512,
+     s21_narrow_avx512, s21_widen_avx512, s21_smicro_avx512},
+#endif
+};
+
+static const s21_float_kernels_t *s21_float_kernels(void) {
+  return &s21_float_table[s21_simd_level()];
+}
+
+static int s21_is_matrix_ok_f(matrixf_t *A) {
+  return A != NULL && A->matrix != NULL && A->rows > 0 && A->columns > 0;
+}
+
+static int s21_same_shape_f(matrixf_t *A, matrixf_t *B) {
+  return A->rows == B->rows && A->columns == B->columns;
+}
+
+static int s21_overlaps_f(matrixf_t *A, matrixf_t *B) {
+  const float *a_lo = A->matrix[0], *a_hi = A->matrix[0];
+  const float *b_lo = B->matrix[0], *b_hi = B->matrix[0];
+  for (int i = 0; i < A->rows; i++) {
+    if (A->matrix[i] < a_lo) a_lo = A->matrix[i];
+    if (A->matrix[i] > a_hi) a_hi = A->matrix[i];
+  }
+  for (int i = 0; i < B->rows; i++) {
+    if (B->matrix[i] < b_lo) b_lo = B->matrix[i];
+    if (B->matrix[i] > b_hi) b_hi = B->matrix[i];
+  }
+  return a_lo < b_hi + B->columns && b_lo < a_hi + A->columns;
+}
+
+int s21_create_matrix_f(int rows, int columns, matrixf_t *result) {
+  int err_code = OK;
+  if (rows < 1 || columns < 1 || columns > INT_MAX - S21_ALIGNMENT ||
+      result == NULL) {
+    err_code = INCORRECT_MATRIX;
+  } else {
+    int per_line = S21_ALIGNMENT / sizeof(float);
+    int stride = (columns + per_line - 1) / per_line * per_line;
+    size_t count = (size_t)rows * (size_t)stride;
+    result->matrix = (float **)malloc(rows * sizeof(float *));
+    result->data =
+        (float *)aligned_alloc(S21_ALIGNMENT, count * sizeof(float));
+    result->rows = rows;
+    result->columns = columns;
+    result->stride = stride;
+    result->flags = 0;
+    if (result->matrix != NULL && result->data != NULL) {
+      memset(result->data, 0, count * sizeof(float));
+      for (int i = 0; i < rows; i++) {
+        result->matrix[i] = result->data + (size_t)i * stride;
+      }
+    } else {
+      s21_remove_matrix_f(result);
+      err_code = INCORRECT_MATRIX;
+    }
+  }
+  return err_code;
+}
+
+void s21_remove_matrix_f(matrixf_t *A) {
+  if (A != NULL) {
+    if (!(A->flags & S21_BORROWED)) {
+      free(A->data);
+      free(A->matrix);
+    }
+    A->matrix = NULL;
+    A->data = NULL;
+    A->rows = 0;
+    A->columns = 0;
+    A->stride = 0;
+    A->flags = 0;
+  }
+}
+
+int s21_eq_matrix_f(matrixf_t *A, matrixf_t *B) {
+  if (!s21_is_matrix_ok_f(A) || !s21_is_matrix_ok_f(B) ||
+      !s21_same_shape_f(A, B))
+    return FAILURE;
+  const s21_float_kernels_t *kernels = s21_float_kernels();
+  int err_code = SUCCESS;
+  for (int i = 0; i < A->rows && err_code; i++) {
+    err_code = kernels->eq(A->columns, A->matrix[i], B->matrix[i],
+                           S21_FLOAT_EQ_TOL);
+  }
+  return err_code;
+}
+
+static int s21_binary_into_f(matrixf_t *A, matrixf_t *B, matrixf_t *result,
+                             int subtract) {
+  int err_code = OK;
+  if (!s21_is_matrix_ok_f(A) || !s21_is_matrix_ok_f(B) ||
+      !s21_is_matrix_ok_f(result)) {
+    err_code = INCORRECT_MATRIX;
+  } else if (!s21_same_shape_f(A, B) || !s21_same_shape_f(A, result)) {
+    err_code = CALCULATION_ERROR;
+  } else {
+    const s21_float_kernels_t *kernels = s21_float_kernels();
+    for (int i = 0; i < A->rows; i++) {
+      if (subtract) {
+        kernels->sub(A->columns, A->matrix[i], B->matrix[i],
+                     result->matrix[i]);
+      } else {
+        kernels->add(A->columns, A->matrix[i], B->matrix[i],
+                     result->matrix[i]);
+      }
+    }
+  }
+  return err_code;
+}
+
+static int s21_binary_f(matrixf_t *A, matrixf_t *B, matrixf_t *result,
+                        int subtract) {
+  int err_code = OK;
+  if (!s21_is_matrix_ok_f(A) || !s21_is_matrix_ok_f(B)) {
+    err_code = INCORRECT_MATRIX;
+  } else if (!s21_same_shape_f(A, B)) {
+    err_code = CALCULATION_ERROR;
+  } else {
+    err_code = s21_create_matrix_f(A->rows, A->columns, result);
+    if (err_code == OK) err_code = s21_binary_into_f(A, B, result, subtract);
+  }
+  return err_code;
+}
+
+int s21_sum_matrix_f(matrixf_t *A, matrixf_t *B, matrixf_t *result) {
+  return s21_binary_f(A, B, result, 0);
+}
+
+int s21_sum_matrix_into_f(matrixf_t *A, matrixf_t *B, matrixf_t *result) {
+  return s21_binary_into_f(A, B, result, 0);
+}
+
+int s21_sub_matrix_f(matrixf_t *A, matrixf_t *B, matrixf_t *result) {
+  return s21_binary_f(A, B, result, 1);
+}
+
+int s21_sub_matrix_into_f(matrixf_t *A, matrixf_t *B, matrixf_t *result) {
+  return s21_binary_into_f(A, B, result, 1);
+}
+
+int s21_mult_number_f(matrixf_t *A, float number, matrixf_t *result) {
+  int err_code = OK;
+  if (s21_is_matrix_ok_f(A)) {
+    err_code = s21_create_matrix_f(A->rows, A->columns, result);
+    if (err_code == OK) err_code = s21_mult_number_into_f(A, number, result);
+  } else {
+    err_code = INCORRECT_MATRIX;
+  }
+  return err_code;
+}
+
+int s21_mult_number_into_f(matrixf_t *A, float number, matrixf_t *result) {
+  int err_code = OK;
+  if (!s21_is_matrix_ok_f(A) || !s21_is_matrix_ok_f(result)) {
+    err_code = INCORRECT_MATRIX;
+  } else if (!s21_same_shape_f(A, result)) {
+    err_code = CALCULATION_ERROR;
+  } else {
+    const s21_float_kernels_t *kernels = s21_float_kernels();
+    for (int i = 0; i < A->rows; i++) {
+      kernels->scale(A->columns, A->matrix[i], number, result->matrix[i]);
+    }
+  }
+  return err_code;
+}
+
+static void s21_spack_a(float *const *a, int ic, int pc, int mc, int kc,
+                        float *dst) {
+  for (int ir = 0; ir < mc; ir += S21_SGEMM_MR) {
+    int mr = mc - ir < S21_SGEMM_MR ? mc - ir : S21_SGEMM_MR;
+    if (mr < S21_SGEMM_MR) {
+      memset(dst, 0, (size_t)kc * S21_SGEMM_MR * sizeof(float));
+    }
+    for (int i = 0; i < mr; i++) {
+      const float *src = a[ic + ir + i] + pc;
+      for (int p = 0; p < kc; p++) dst[p * S21_SGEMM_MR + i] = src[p];
+    }
+    dst += (size_t)kc * S21_SGEMM_MR;
+  }
+}
+
+static void s21_spack_b(float *const *b, int pc, int jc, int kc, int nc,
+                        float *dst) {
+  for (int jr = 0; jr < nc; jr += S21_SGEMM_NR) {
+    int nr = nc - jr < S21_SGEMM_NR ? nc - jr : S21_SGEMM_NR;
+    if (nr < S21_SGEMM_NR) {
+      memset(dst, 0, (size_t)kc * S21_SGEMM_NR * sizeof(float));
+    }
+    for (int p = 0; p < kc; p++) {
+      memcpy(dst + p * S21_SGEMM_NR, b[pc + p] + jc + jr,
+             nr * sizeof(float));
+    }
+    dst += (size_t)kc * S21_SGEMM_NR;
+  }
+}
+
+static void s21_supdate_tile(const float *ab, int mr, int nr, int accumulate,
+                             float **c, int col) {
+  for (int i = 0; i < mr; i++) {
+    float *dst = c[i] + col;
+    const float *src = ab + i * S21_SGEMM_NR;
+    if (accumulate) {
+      for (int j = 0; j < nr; j++) dst[j] += src[j];
+    } else {
+      memcpy(dst, src, nr * sizeof(float));
+    }
+  }
+}
+
+static void s21_sgemm_small(int m, int n, int k, float *const *a,
+                            float *const *b, float **c) {
+  for (int i = 0; i < m; i++) {
+    float *c_row = c[i];
+    memset(c_row, 0, n * sizeof(float));
+    for (int p = 0; p < k; p++) {
+      float scale = a[i][p];
+      const float *b_row = b[p];
+      for (int j = 0; j < n; j++) c_row[j] += scale * b_row[j];
+    }
+  }
+}
+
+static void s21_sgemm_serial(const s21_float_kernels_t *kernels, int m, int n,
+                             int k, float *const *a, float *const *b,
+                             float **c) {
+  if ((double)m * n * k <= S21_GEMM_SMALL) {
+    s21_sgemm_small(m, n, k, a, b, c);
+    return;
+  }
+  int kc_max = k < S21_SGEMM_KC ? k : S21_SGEMM_KC;
+  int mc_max = m < S21_SGEMM_MC ? m : S21_SGEMM_MC;
+  int nc_max = n < S21_SGEMM_NC ? n : S21_SGEMM_NC;
+  mc_max = (mc_max + S21_SGEMM_MR - 1) / S21_SGEMM_MR * S21_SGEMM_MR;
+  nc_max = (nc_max + S21_SGEMM_NR - 1) / S21_SGEMM_NR * S21_SGEMM_NR;
+  size_t per_line = S21_ALIGNMENT / sizeof(float);
+  size_t a_size = (size_t)mc_max * kc_max;
+  a_size = (a_size + per_line - 1) / per_line * per_line;
+  size_t floats = a_size + (size_t)kc_max * nc_max;
+  float *a_pack = (float *)s21_thread_buffer((floats + 1) / 2);
+  if (a_pack == NULL) {
+    s21_sgemm_small(m, n, k, a, b, c);
+    return;
+  }
+  float *b_pack = a_pack + a_size;
+  float ab[S21_SGEMM_MR * S21_SGEMM_NR] __attribute__((aligned(S21_ALIGNMENT)));
+  for (int j0 = 0; j0 < n; j0 += S21_SGEMM_NC) {
+    int nc = n - j0 < S21_SGEMM_NC ? n - j0 : S21_SGEMM_NC;
+    for (int p0 = 0; p0 < k; p0 += S21_SGEMM_KC) {
+      int kc = k - p0 < S21_SGEMM_KC ? k - p0 : S21_SGEMM_KC;
+      s21_spack_b(b, p0, j0, kc, nc, b_pack);
+      for (int i0 = 0; i0 < m; i0 += S21_SGEMM_MC) {
+        int mc = m - i0 < S21_SGEMM_MC ? m - i0 : S21_SGEMM_MC;
+        s21_spack_a(a, i0, p0, mc, kc, a_pack);
+        for (int jr = 0; jr < nc; jr += S21_SGEMM_NR) {
+          int nr = nc - jr < S21_SGEMM_NR ? nc - jr : S21_SGEMM_NR;
+          for (int ir = 0; ir < mc; ir += S21_SGEMM_MR) {
+            int mr = mc - ir < S21_SGEMM_MR ? mc - ir : S21_SGEMM_MR;
+            kernels->micro(kc, a_pack + (size_t)ir * kc,
+                           b_pack + (size_t)jr * kc, ab);
+            s21_supdate_tile(ab, mr, nr, p0 > 0, c + i0 + ir, j0 + jr);
+          }
+        }
+      }
+    }
+  }
+}
+
+static void s21_sgemm_task(void *ctx, int task) {
+  const s21_sgemm_job_t *job = (const s21_sgemm_job_t *)ctx;
+  int i0 = task * job->rows_per_task;
+  int mt = job->m - i0 < job->rows_per_task ? job->m - i0 : job->rows_per_task;
+  s21_sgemm_serial(job->kernels, mt, job->n, job->k, job->a + i0, job->b,
+                   job->c + i0);
+}
+
+static void s21_sgemm(matrixf_t *A, matrixf_t *B, matrixf_t *C) {
+  s21_sgemm_job_t job = {s21_float_kernels(), A->rows, B->columns, A->columns,
+                         A->rows, A->matrix, B->matrix, C->matrix};
+  int workers = s21_parallel_workers((double)job.m * job.n * job.k);
+  if (workers > 1) {
+    int rows = (job.m + 2 * workers - 1) / (2 * workers);
+    rows = (rows + S21_SGEMM_MR - 1) / S21_SGEMM_MR * S21_SGEMM_MR;
+    job.rows_per_task = rows;
+  }
+  int tasks = (job.m + job.rows_per_task - 1) / job.rows_per_task;
+  s21_parallel_for(tasks, s21_sgemm_task, &job);
+}
+
+int s21_mult_matrix_f(matrixf_t *A, matrixf_t *B, matrixf_t *result) {
+  int err_code = OK;
+  if (!s21_is_matrix_ok_f(A) || !s21_is_matrix_ok_f(B)) {
+    err_code = INCORRECT_MATRIX;
+  } else if (A->columns != B->rows) {
+    err_code = CALCULATION_ERROR;
+  } else {
+    err_code = s21_create_matrix_f(A->rows, B->columns, result);
+    if (err_code == OK) err_code = s21_mult_matrix_into_f(A, B, result);
+  }
+  return err_code;
+}
+
+int s21_mult_matrix_into_f(matrixf_t *A, matrixf_t *B, matrixf_t *result) {
+  int err_code = OK;
+  if (!s21_is_matrix_ok_f(A) || !s21_is_matrix_ok_f(B) ||
+      !s21_is_matrix_ok_f(result)) {
+    err_code = INCORRECT_MATRIX;
+  } else if (A->columns != B->rows || result->rows != A->rows ||
+             result->columns != B->columns) {
+    err_code = CALCULATION_ERROR;
+  } else if (s21_overlaps_f(result, A) || s21_overlaps_f(result, B)) {
+    matrixf_t product = {0};
+    err_code = s21_create_matrix_f(result->rows, result->columns, &product);
+    if (err_code == OK) {
+      s21_sgemm(A, B, &product);
+      for (int i = 0; i < result->rows; i++) {
+        memcpy(result->matrix[i], product.matrix[i],
+               result->columns * sizeof(float));
+      }
+    }
+    s21_remove_matrix_f(&product);
+  } else {
+    s21_sgemm(A, B, result);
+  }
+  return err_code;
+}
+
+static void s21_fill_transpose_f(matrixf_t *A, matrixf_t *result) {
+  for (int i0 = 0; i0 < A->rows; i0 += S21_TRANSPOSE_LEAF) {
+    int i1 = A->rows - i0 < S21_TRANSPOSE_LEAF ? A->rows
+                                                : i0 + S21_TRANSPOSE_LEAF;
+    for (int j0 = 0; j0 < A->columns; j0 += S21_TRANSPOSE_LEAF) {
+      int j1 = A->columns - j0 < S21_TRANSPOSE_LEAF ? A->columns
+                                                     : j0 + S21_TRANSPOSE_LEAF;
+      for (int i = i0; i < i1; i++) {
+        for (int j = j0; j < j1; j++) result->matrix[j][i] = A->matrix[i][j];
+      }
+    }
+  }
+}
+
+int s21_transpose_f(matrixf_t *A, matrixf_t *result) {
+  int err_code = OK;
+  if (s21_is_matrix_ok_f(A)) {
+    err_code = s21_create_matrix_f(A->columns, A->rows, result);
+    if (err_code == OK) s21_fill_transpose_f(A, result);
+  } else {
+    err_code = INCORRECT_MATRIX;
+  }
+  return err_code;
+}
+
+int s21_transpose_into_f(matrixf_t *A, matrixf_t *result) {
+  int err_code = OK;
+  if (!s21_is_matrix_ok_f(A) || !s21_is_matrix_ok_f(result)) {
+    err_code = INCORRECT_MATRIX;
+  } else if (result->rows != A->columns || result->columns != A->rows) {
+    err_code = CALCULATION_ERROR;
+  } else if (result->matrix == A->matrix && A->rows == A->columns) {
+    for (int i = 0; i < A->rows; i++) {
+      for (int j = i + 1; j < A->rows; j++) {
+        float tmp = A->matrix[i][j];
+        A->matrix[i][j] = A->matrix[j][i];
+        A->matrix[j][i] = tmp;
+      }
+    }
+  } else if (s21_overlaps_f(result, A)) {
+    matrixf_t copy = {0};
+    err_code = s21_transpose_f(A, &copy);
+    for (int i = 0; i < result->rows && err_code == OK; i++) {
+      memcpy(result->matrix[i], copy.matrix[i],
+             result->columns * sizeof(float));
+    }
+    s21_remove_matrix_f(&copy);
+  } else {
+    s21_fill_transpose_f(A, result);
+  }
+  return err_code;
+}
+
+int s21_matrix_to_float(matrix_t *A, matrixf_t *result) {
+  if (!s21_is_matrix_ok(A)) return INCORRECT_MATRIX;
+  int err_code = s21_create_matrix_f(A->rows, A->columns, result);
+  if (err_code == OK && s21_is_lazy(A)) {
+    for (int i = 0; i < A->rows; i++) {
+      for (int j = 0; j < A->columns; j++) {
+        result->matrix[i][j] = (float)*s21_at(A, i, j);
+      }
+    }
+  } else if (err_code == OK) {
+    const s21_float_kernels_t *kernels = s21_float_kernels();
+    for (int i = 0; i < A->rows; i++) {
+      kernels->narrow(A->columns, A->matrix[i], result->matrix[i]);
+    }
+  }
+  return err_code;
+}
+
+int s21_matrix_to_double(matrixf_t *A, matrix_t *result) {
+  if (!s21_is_matrix_ok_f(A)) return INCORRECT_MATRIX;
+  int err_code = s21_create_matrix(A->rows, A->columns, result);
+  if (err_code == OK) {
+    const s21_float_kernels_t *kernels = s21_float_kernels();
+    for (int i = 0; i < A->rows; i++) {
+      kernels->widen(A->columns, A->matrix[i], result->matrix[i]);
+    }
+  }
+  return err_code;
+}
+
+int s21_determinant_f(matrixf_t *A, double *result) {
+  if (!s21_is_matrix_ok_f(A)) return INCORRECT_MATRIX;
+  matrix_t wide = {0};
+  int err_code = CALCULATION_ERROR;
+  if (A->rows == A->columns) {
+    err_code = s21_matrix_to_double(A, &wide);
+    if (err_code == OK) err_code = s21_determinant(&wide, result);
+  }
+  s21_remove_matrix(&wide);
+  return err_code;
+}
+
+static int s21_square_f(matrixf_t *A, matrixf_t *result,
+                        int (*fn)(matrix_t *, matrix_t *)) {
+  matrix_t wide = {0};
+  matrix_t out = {0};
+  int err_code = s21_matrix_to_double(A, &wide);
+  if (err_code == OK) err_code = fn(&wide, &out);
+  if (err_code == OK) err_code = s21_matrix_to_float(&out, result);
+  s21_remove_matrix(&wide);
+  s21_remove_matrix(&out);
+  return err_code;
+}
+
+int s21_calc_complements_f(matrixf_t *A, matrixf_t *result) {
+  if (!s21_is_matrix_ok_f(A)) return INCORRECT_MATRIX;
+  return s21_square_f(A, result, s21_calc_complements);
+}
+
+int s21_inverse_matrix_f(matrixf_t *A, matrixf_t *result) {
+  if (!s21_is_matrix_ok_f(A)) return INCORRECT_MATRIX;
+  return s21_square_f(A, result, s21_inverse_matrix);
+}
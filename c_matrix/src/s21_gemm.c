@@ -0,0 +1,270 @@
+#include <string.h>
+
+#include "s21_internal.h"
+
+static void s21_pack_a(int trans, double *const *a, int col, int ic, int pc,
+                       int mc, int kc, double *dst) {
+  for (int ir = 0; ir < mc; ir += S21_GEMM_MR) {
+    int mr = mc - ir < S21_GEMM_MR ? mc - ir : S21_GEMM_MR;
+    if (mr < S21_GEMM_MR) {
+      memset(dst, 0, (size_t)kc * S21_GEMM_MR * sizeof(double));
+    }
+    if (trans) {
+      for (int p = 0; p < kc; p++) {
+        const double *src = a[pc + p] + col + ic + ir;
+        for (int i = 0; i < mr; i++) dst[p * S21_GEMM_MR + i] = src[i];
+      }
+    } else {
+      for (int i = 0; i < mr; i++) {
+        const double *src = a[ic + ir + i] + col + pc;
+        for (int p = 0; p < kc; p++) dst[p * S21_GEMM_MR + i] = src[p];
+      }
+    }
+    dst += (size_t)kc * S21_GEMM_MR;
+  }
+}
+
+static void s21_pack_b(int trans, double *const *b, int col, int pc, int jc,
+                       int kc, int nc, double *dst) {
+  int tail = nc % S21_GEMM_NR;
+  if (tail) {
+    memset(dst + (size_t)(nc - tail) * kc, 0,
+           (size_t)kc * S21_GEMM_NR * sizeof(double));
+  }
+  if (trans) {
+    for (int jr = 0; jr < nc; jr += S21_GEMM_NR) {
+      int nr = nc - jr < S21_GEMM_NR ? nc - jr : S21_GEMM_NR;
+      double *panel = dst + (size_t)jr * kc;
+      for (int j = 0; j < nr; j++) {
+        const double *src = b[jc + jr + j] + col + pc;
+        for (int p = 0; p < kc; p++) panel[p * S21_GEMM_NR + j] = src[p];
+      }
+    }
+  } else {
+    for (int p = 0; p < kc; p++) {
+      const double *src = b[pc + p] + col + jc;
+      for (int jr = 0; jr < nc; jr += S21_GEMM_NR) {
+        int nr = nc - jr < S21_GEMM_NR ? nc - jr : S21_GEMM_NR;
+        memcpy(dst + (size_t)jr * kc + p * S21_GEMM_NR, src + jr,
+               nr * sizeof(double));
+      }
+    }
+  }
+}
+
+static void s21_update_tile(const double *ab, int mr, int nr, double alpha,
+                            double beta, double **c, int col) {
+  for (int i = 0; i < mr; i++) {
+    double *dst = c[i] + col;
+    const double *src = ab + i * S21_GEMM_NR;
+    if (beta == 0) {
+      for (int j = 0; j < nr; j++) dst[j] = alpha * src[j];
+    } else if (beta == 1) {
+      for (int j = 0; j < nr; j++) dst[j] += alpha * src[j];
+    } else {
+      for (int j = 0; j < nr; j++) dst[j] = alpha * src[j] + beta * dst[j];
+    }
+  }
+}
+
+static void s21_scale_rows(int m, int n, double beta, double **c, int col) {
+  for (int i = 0; i < m; i++) {
+    double *dst = c[i] + col;
+    if (beta == 0) {
+      memset(dst, 0, n * sizeof(double));
+    } else if (beta != 1) {
+      for (int j = 0; j < n; j++) dst[j] *= beta;
+    }
+  }
+}
+
+static void s21_dgemm_small(int m, int n, int k, double alpha,
+                            double *const *a, int ja, double *const *b, int jb,
+                            double beta, double **c, int jc) {
+  s21_scale_rows(m, n, beta, c, jc);
+  for (int i = 0; i < m; i++) {
+    const double *a_row = a[i] + ja;
+    double *c_row = c[i] + jc;
+    for (int p = 0; p < k; p++) {
+      double scale = alpha * a_row[p];
+      const double *b_row = b[p] + jb;
+      for (int j = 0; j < n; j++) c_row[j] += scale * b_row[j];
+    }
+  }
+}
+
+static void s21_dgemm_serial(int trans_a, int trans_b, int m, int n, int k,
+                             double alpha, double *const *a, int ja,
+                             double *const *b, int jb, double beta, double **c,
+                             int jc) {
+  if (!trans_a && !trans_b && (double)m * n * k <= S21_GEMM_SMALL) {
+    s21_dgemm_small(m, n, k, alpha, a, ja, b, jb, beta, c, jc);
+    return;
+  }
+  int kc_max = k < S21_GEMM_KC ? k : S21_GEMM_KC;
+  int mc_max = m < S21_GEMM_MC ? m : S21_GEMM_MC;
+  int nc_max = n < S21_GEMM_NC ? n : S21_GEMM_NC;
+  mc_max = (mc_max + S21_GEMM_MR - 1) / S21_GEMM_MR * S21_GEMM_MR;
+  nc_max = (nc_max + S21_GEMM_NR - 1) / S21_GEMM_NR * S21_GEMM_NR;
+  size_t per_line = S21_ALIGNMENT / sizeof(double);
+  size_t a_size = (size_t)mc_max * kc_max;
+  a_size = (a_size + per_line - 1) / per_line * per_line;
+  double *a_pack = s21_thread_buffer(a_size + (size_t)kc_max * nc_max);
+  if (a_pack == NULL) {
+    s21_dgemm_small(m, n, k, alpha, a, ja, b, jb, beta, c, jc);
+    return;
+  }
+  double *b_pack = a_pack + a_size;
+  s21_micro_fn micro = s21_kernels()->micro;
+  double ab[S21_GEMM_MR * S21_GEMM_NR] __attribute__((aligned(S21_ALIGNMENT)));
+  for (int j0 = 0; j0 < n; j0 += S21_GEMM_NC) {
+    int nc = n - j0 < S21_GEMM_NC ? n - j0 : S21_GEMM_NC;
+    for (int p0 = 0; p0 < k; p0 += S21_GEMM_KC) {
+      int kc = k - p0 < S21_GEMM_KC ? k - p0 : S21_GEMM_KC;
+      double beta_eff = p0 == 0 ? beta : 1.0;
+      s21_pack_b(trans_b, b, jb, p0, j0, kc, nc, b_pack);
+      for (int i0 = 0; i0 < m; i0 += S21_GEMM_MC) {
+        int mc = m - i0 < S21_GEMM_MC ? m - i0 : S21_GEMM_MC;
+        s21_pack_a(trans_a, a, ja, i0, p0, mc, kc, a_pack);
+        for (int jr = 0; jr < nc; jr += S21_GEMM_NR) {
+          int nr = nc - jr < S21_GEMM_NR ? nc - jr : S21_GEMM_NR;
+          for (int ir = 0; ir < mc; ir += S21_GEMM_MR) {
+            int mr = mc - ir < S21_GEMM_MR ? mc - ir : S21_GEMM_MR;
+            micro(kc, a_pack + (size_t)ir * kc, b_pack + (size_t)jr * kc, ab);
+            s21_update_tile(ab, mr, nr, alpha, beta_eff, c + i0 + ir,
+                            jc + j0 + jr);
+          }
+        }
+      }
+    }
+  }
+}
+
+typedef struct s21_gemm_job {
+  int trans_a, trans_b;
+  int m, n, k;
+  double alpha, beta;
+  double *const *a;
+  double *const *b;
+  double **c;
+  int ja, jb, jc;
+  int tile_m, tile_n, tiles_n;
+} s21_gemm_job_t;
+
+static void s21_gemm_tile(void *ctx, int task) {
+  const s21_gemm_job_t *job = (const s21_gemm_job_t *)ctx;
+  int i0 = task / job->tiles_n * job->tile_m;
+  int j0 = task % job->tiles_n * job->tile_n;
+  int mt = job->m - i0 < job->tile_m ? job->m - i0 : job->tile_m;
+  int nt = job->n - j0 < job->tile_n ? job->n - j0 : job->tile_n;
+  double *const *a = job->trans_a ? job->a : job->a + i0;
+  double *const *b = job->trans_b ? job->b + j0 : job->b;
+  int ja = job->trans_a ? job->ja + i0 : job->ja;
+  int jb = job->trans_b ? job->jb : job->jb + j0;
+  s21_dgemm_serial(job->trans_a, job->trans_b, mt, nt, job->k, job->alpha, a,
+                   ja, b, jb, job->beta, job->c + i0, job->jc + j0);
+}
+
+static int s21_tile_count(int m, int n, int tile_m, int tile_n) {
+  return ((m + tile_m - 1) / tile_m) * ((n + tile_n - 1) / tile_n);
+}
+
+void s21_dgemm(int trans_a, int trans_b, int m, int n, int k, double alpha,
+               double *const *a, int ja, double *const *b, int jb,
+               double beta, double **c, int jc) {
+  if (m < 1 || n < 1) return;
+  if (k < 1 || alpha == 0) {
+    s21_scale_rows(m, n, beta, c, jc);
+    return;
+  }
+  int workers = s21_parallel_workers((double)m * n * k);
+  if (workers > 1) {
+    s21_gemm_job_t job = {trans_a, trans_b, m, n, k, alpha, beta, a, b, c,
+                          ja, jb, jc, S21_GEMM_TILE_M, S21_GEMM_TILE_N, 0};
+    int min_m = 4 * S21_GEMM_MR;
+    int min_n = 4 * S21_GEMM_NR;
+    while (s21_tile_count(m, n, job.tile_m, job.tile_n) < 2 * workers &&
+           (job.tile_m > min_m || job.tile_n > min_n)) {
+      if (job.tile_m > min_m && (job.tile_m * 2 >= job.tile_n ||
+                                 job.tile_n <= min_n)) {
+        job.tile_m /= 2;
+      } else {
+        job.tile_n /= 2;
+      }
+    }
+    job.tiles_n = (n + job.tile_n - 1) / job.tile_n;
+    s21_parallel_for(s21_tile_count(m, n, job.tile_m, job.tile_n),
+                     s21_gemm_tile, &job);
+  } else {
+    s21_dgemm_serial(trans_a, trans_b, m, n, k, alpha, a, ja, b, jb, beta, c,
+                     jc);
+  }
+}
+
+static int s21_gemm_aliased(int trans_a, int trans_b, int k, double alpha,
+                            matrix_t *A, matrix_t *B, double beta,
+                            matrix_t *C) {
+  s21_scratch_t scratch;
+  size_t bytes = s21_matrix_bytes(C->rows, C->columns);
+  int err_code = s21_scratch_open(&scratch, bytes);
+  if (err_code == OK) {
+    matrix_t product = {0};
+    const s21_kernels_t *kernels = s21_kernels();
+    s21_create_matrix_arena(C->rows, C->columns, scratch.arena, &product);
+    s21_dgemm(trans_a, trans_b, C->rows, C->columns, k, alpha, A->matrix, 0,
+              B->matrix, 0, 0.0, product.matrix, 0);
+    for (int i = 0; i < C->rows; i++) {
+      if (beta == 0) {
+        memcpy(C->matrix[i], product.matrix[i], C->columns * sizeof(double));
+      } else {
+        kernels->scale(C->columns, C->matrix[i], beta, C->matrix[i]);
+        kernels->add(C->columns, product.matrix[i], C->matrix[i], C->matrix[i]);
+      }
+    }
+  }
+  s21_scratch_close(&scratch);
+  return err_code;
+}
+
+static int s21_gemm_lazy(int trans_a, int trans_b, double alpha, matrix_t *A,
+                         matrix_t *B, double beta, matrix_t *C) {
+  matrix_t a, b, c;
+  s21_storage(A, &a);
+  s21_storage(B, &b);
+  s21_storage(C, &c);
+  trans_a ^= s21_is_lazy(A);
+  trans_b ^= s21_is_lazy(B);
+  return s21_is_lazy(C) ? s21_gemm(!trans_b, !trans_a, alpha, &b, &a, beta, &c)
+                        : s21_gemm(trans_a, trans_b, alpha, &a, &b, beta, &c);
+}
+
+int s21_gemm(int trans_a, int trans_b, double alpha, matrix_t *A, matrix_t *B,
+             double beta, matrix_t *C) {
+  int err_code = OK;
+  if (s21_is_matrix_ok(A) && s21_is_matrix_ok(B) && s21_is_matrix_ok(C) &&
+      s21_is_writable(C)) {
+    int m = trans_a ? A->columns : A->rows;
+    int k = trans_a ? A->rows : A->columns;
+    int k_b = trans_b ? B->columns : B->rows;
+    int n = trans_b ? B->rows : B->columns;
+    if (k != k_b || C->rows != m || C->columns != n) {
+      err_code = CALCULATION_ERROR;
+    } else if (s21_is_lazy(A) || s21_is_lazy(B) || s21_is_lazy(C)) {
+      err_code = s21_gemm_lazy(trans_a, trans_b, alpha, A, B, beta, C);
+    } else if (s21_overlaps(C, A) || s21_overlaps(C, B)) {
+      err_code = s21_gemm_aliased(trans_a, trans_b, k, alpha, A, B, beta, C);
+    } else {
+      int levels = 0;
+      if (trans_a == S21_NO_TRANS && trans_b == S21_NO_TRANS && beta == 0) {
+        levels = s21_strassen_levels(m, k, n);
+      }
+      if (levels == 0 || s21_strassen(levels, alpha, A, B, C) != OK) {
+        s21_dgemm(trans_a, trans_b, m, n, k, alpha, A->matrix, 0, B->matrix,
+                  0, beta, C->matrix, 0);
+      }
+    }
+  } else {
+    err_code = INCORRECT_MATRIX;
+  }
+  return err_code;
+}
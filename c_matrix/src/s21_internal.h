@@ -0,0 +1,159 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "s21_matrix.h"
+
+#define S21_LU_BLOCK 64
+#define S21_EXACT_DET_MAX 10
+#define S21_SMALL_MAX 4
+#define S21_QR_BLOCK 64
+#define S21_QR_LEAF 8
+
+#define S21_GEMM_MR 4
+#define S21_GEMM_NR 8
+#define S21_GEMM_MC 128
+#define S21_GEMM_KC 256
+#define S21_GEMM_NC 2048
+#define S21_GEMM_SMALL (32.0 * 32.0 * 32.0)
+#define S21_GEMM_TILE_M 256
+#define S21_GEMM_TILE_N 512
+
+#define S21_SGEMM_MR 6
+#define S21_SGEMM_NR 16
+#define S21_SGEMM_MC 120
+#define S21_SGEMM_KC 256
+#define S21_SGEMM_NC 4096
+#define S21_FLOAT_EQ_TOL 1e-5f
+
+#define S21_TRANSPOSE_LEAF 32
+
+#define S21_BATCH_LANES 8
+#define S21_BATCH_TASK 4096
+
+#define S21_FILE_HEADER 4096
+#define S21_FILE_VERSION 1
+#define S21_DTYPE_FLOAT64 1
+
+#define S21_PARALLEL_THRESHOLD 128
+#define S21_MAX_THREADS 256
+
+#if defined(__x86_64__) || defined(__i386__)
+#define S21_X86 1
+#define S21_AVX2 __attribute__((target("avx2,fma")))
+#define S21_AVX512 __attribute__((target("avx512f")))
+#endif
+
+static inline int s21_is_lazy(const matrix_t *A) {
+  return (A->flags & S21_TRANSPOSED) != 0;
+}
+
+static inline int s21_is_writable(const matrix_t *A) {
+  return (A->flags & S21_READONLY) == 0;
+}
+
+static inline double *s21_at(matrix_t *A, int i, int j) {
+  return s21_is_lazy(A) ? &A->matrix[j][i] : &A->matrix[i][j];
+}
+
+typedef void (*s21_micro_fn)(int kc, const double *a, const double *b,
+                             double *ab);
+
+typedef struct s21_kernels {
+  void (*add)(int n, const double *a, const double *b, double *out);
+  void (*sub)(int n, const double *a, const double *b, double *out);
+  void (*scale)(int n, const double *a, double k, double *out);
+  int (*eq)(int n, const double *a, const double *b, double tol);
+  s21_micro_fn micro;
+  void (*transpose)(double *const *src, int js, double **dst, int jd);
+  int transpose_block;
+} s21_kernels_t;
+
+const s21_kernels_t *s21_kernels(void);
+
+typedef void (*s21_task_fn)(void *ctx, int task);
+
+int s21_parallel_workers(double work);
+void s21_parallel_for(int tasks, s21_task_fn fn, void *ctx);
+double *s21_thread_buffer(size_t count);
+void s21_release_thread_buffer(void);
+
+typedef struct s21_scratch {
+  arena_t *arena;
+  arena_t *previous;
+  size_t mark;
+  arena_t local;
+} s21_scratch_t;
+
+size_t s21_align_bytes(size_t bytes);
+int s21_scratch_open(s21_scratch_t *scratch, size_t bytes);
+void s21_scratch_close(s21_scratch_t *scratch);
+size_t s21_lu_scratch_bytes(int n);
+
+int s21_row_stride(int columns);
+double *s21_alloc_block(size_t count);
+void s21_copy_matrix(matrix_t *A, matrix_t *result);
+void s21_minor_rows(matrix_t *A, int row, int column, double **rows);
+void s21_fill_transpose(matrix_t *A, matrix_t *result);
+void s21_storage(matrix_t *A, matrix_t *result);
+size_t s21_orient_bytes(matrix_t *A, int lazy);
+void s21_orient(matrix_t *A, int lazy, arena_t *arena, matrix_t *result);
+void s21_copy_logical(matrix_t *A, matrix_t *result);
+void s21_transpose_square(matrix_t *A);
+int s21_overlaps(matrix_t *A, matrix_t *B);
+double s21_max_abs(matrix_t *A);
+
+void s21_dgemm(int trans_a, int trans_b, int m, int n, int k, double alpha,
+               double *const *a, int ja, double *const *b, int jb,
+               double beta, double **c, int jc);
+
+enum S21_UPLO { S21_LOWER, S21_UPPER };
+
+void s21_trsm(int uplo, int trans, int unit, int n, double *const *t, int jt,
+              int nrhs, double **b, int jb);
+
+int s21_chol_candidate(matrix_t *A);
+int s21_chol_det(matrix_t *A, double *result);
+int s21_chol_inverse(matrix_t *A, matrix_t *result);
+int s21_chol_factor(double **a, int n, double tol);
+double s21_chol_tolerance(matrix_t *A);
+void s21_chol_invert(double **l, int n, double **w, double **result);
+
+int s21_strassen_levels(int m, int k, int n);
+int s21_strassen(int levels, double alpha, matrix_t *A, matrix_t *B,
+                 matrix_t *C);
+
+typedef struct s21_file_header {
+  char magic[8];
+  uint32_t version;
+  uint32_t byte_order;
+  uint32_t dtype;
+  uint32_t header_size;
+  int32_t rows;
+  int32_t columns;
+  int32_t stride;
+  uint32_t reserved;
+  uint64_t data_bytes;
+  uint64_t checksum;
+} s21_file_header_t;
+
+void s21_file_header(int rows, int columns, s21_file_header_t *header);
+int s21_read_header(int fd, s21_file_header_t *header);
+uint64_t s21_checksum(const double *data, size_t count);
+void s21_unmap_matrix(matrix_t *A);
+
+int s21_lu_factor(double **a, int n, int *piv);
+int s21_lu_rank(double **a, int n);
+double s21_lu_det(double **a, int n, int sign);
+double s21_lu_tolerance(int n, double max_abs);
+int s21_lu_is_singular(double **a, int n);
+void s21_lu_permute(const int *piv, int n, double **b, int nrhs);
+void s21_lu_permute_back(const int *piv, int n, double **b, int nrhs);
+void s21_lu_solve(double **lu, int n, double **b, int nrhs);
+void s21_lu_inverse(double **lu, const int *piv, int n, double **result);
+void s21_lu_full(double **a, int n, int *prow, int *pcol);
+void s21_lu_unpermute(const int *prow, const int *pcol, int n, double **b);
+int s21_lu_parity(const int *piv, int n);
+double s21_det_small(matrix_t *A);
+int s21_small_inverse(matrix_t *A, matrix_t *result);
+void s21_small_complements(matrix_t *A, matrix_t *result);
@@ -0,0 +1,159 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <fcntl.h>
+#include <limits.h>
+#include <stdint.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "s21_internal.h"
+
+static const char s21_magic[8] = {'S', '2', '1', 'M', 'A', 'T', 'R', 'X'};
+
+uint64_t s21_checksum(const double *data, size_t count) {
+  uint64_t hash = 14695981039346656037ull;
+  for (size_t i = 0; i < count; i++) {
+    uint64_t word = 0;
+    memcpy(&word, &data[i], sizeof(word));
+    hash = (hash ^ word) * 1099511628211ull;
+  }
+  return hash;
+}
+
+static size_t s21_mapped_bytes(int rows, int stride) {
+  return S21_FILE_HEADER + (size_t)rows * stride * sizeof(double);
+}
+
+void s21_file_header(int rows, int columns, s21_file_header_t *header) {
+  int stride = s21_row_stride(columns);
+  memset(header, 0, sizeof(*header));
+  memcpy(header->magic, s21_magic, sizeof(s21_magic));
+  header->version = S21_FILE_VERSION;
+  header->byte_order = 0x01020304u;
+  header->dtype = S21_DTYPE_FLOAT64;
+  header->header_size = S21_FILE_HEADER;
+  header->rows = rows;
+  header->columns = columns;
+  header->stride = stride;
+  header->data_bytes = (uint64_t)rows * stride * sizeof(double);
+}
+
+int s21_save_matrix(matrix_t *A, const char *path) {
+  if (!s21_is_matrix_ok(A) || path == NULL) return INCORRECT_MATRIX;
+  int stride = s21_row_stride(A->columns);
+  double *row = s21_alloc_block(stride);
+  FILE *file = row ? fopen(path, "wb") : NULL;
+  int err_code = file ? OK : CALCULATION_ERROR;
+  if (err_code == OK) {
+    s21_file_header_t header;
+    s21_file_header(A->rows, A->columns, &header);
+    unsigned char page[S21_FILE_HEADER] = {0};
+    if (fwrite(page, 1, sizeof(page), file) != sizeof(page)) {
+      err_code = CALCULATION_ERROR;
+    }
+    memset(row, 0, stride * sizeof(double));
+    for (int i = 0; i < A->rows && err_code == OK; i++) {
+      if (s21_is_lazy(A)) {
+        for (int j = 0; j < A->columns; j++) row[j] = A->matrix[j][i];
+      } else {
+        memcpy(row, A->matrix[i], A->columns * sizeof(double));
+      }
+      header.checksum = header.checksum * 31 + s21_checksum(row, stride);
+      if (fwrite(row, sizeof(double), stride, file) != (size_t)stride) {
+        err_code = CALCULATION_ERROR;
+      }
+    }
+    if (err_code == OK && fseek(file, 0, SEEK_SET) != 0) {
+      err_code = CALCULATION_ERROR;
+    }
+    if (err_code == OK && fwrite(&header, sizeof(header), 1, file) != 1) {
+      err_code = CALCULATION_ERROR;
+    }
+  }
+  if (file != NULL && fclose(file) != 0) err_code = CALCULATION_ERROR;
+  free(row);
+  return err_code;
+}
+
+static int s21_header_ok(const s21_file_header_t *header, off_t file_size) {
+  return memcmp(header->magic, s21_magic, sizeof(s21_magic)) == 0 &&
+         header->version == S21_FILE_VERSION &&
+         header->byte_order == 0x01020304u &&
+         header->dtype == S21_DTYPE_FLOAT64 &&
+         header->header_size == S21_FILE_HEADER && header->rows > 0 &&
+         header->columns > 0 && header->stride >= header->columns &&
+         header->stride % (S21_ALIGNMENT / sizeof(double)) == 0 &&
+         header->data_bytes ==
+             (uint64_t)header->rows * header->stride * sizeof(double) &&
+         (uint64_t)file_size >= S21_FILE_HEADER + header->data_bytes;
+}
+
+int s21_read_header(int fd, s21_file_header_t *header) {
+  struct stat st;
+  int err_code = CALCULATION_ERROR;
+  if (fstat(fd, &st) == 0 && st.st_size >= S21_FILE_HEADER &&
+      pread(fd, header, sizeof(*header), 0) == (ssize_t)sizeof(*header) &&
+      s21_header_ok(header, st.st_size) &&
+      header->data_bytes <= SIZE_MAX - S21_FILE_HEADER) {
+    err_code = OK;
+  }
+  return err_code;
+}
+
+static int s21_verify(const s21_file_header_t *header, const double *data) {
+  uint64_t checksum = 0;
+  for (int i = 0; i < header->rows; i++) {
+    const double *row = data + (size_t)i * header->stride;
+    checksum = checksum * 31 + s21_checksum(row, header->stride);
+  }
+  return checksum == header->checksum;
+}
+
+int s21_map_matrix(const char *path, int mode, matrix_t *result) {
+  if (path == NULL || result == NULL) return INCORRECT_MATRIX;
+  memset(result, 0, sizeof(*result));
+  int err_code = CALCULATION_ERROR;
+  s21_file_header_t header;
+  int fd = open(path, O_RDONLY);
+  if (fd >= 0 && s21_read_header(fd, &header) == OK) {
+    size_t length = s21_mapped_bytes(header.rows, header.stride);
+    int prot = PROT_READ;
+    int flags = MAP_SHARED;
+    if (mode & S21_MAP_PRIVATE) {
+      prot |= PROT_WRITE;
+      flags = MAP_PRIVATE;
+    }
+    unsigned char *base =
+        (unsigned char *)mmap(NULL, length, prot, flags, fd, 0);
+    double **rows = (double **)malloc(header.rows * sizeof(double *));
+    if (base != MAP_FAILED && rows != NULL) {
+      double *data = (double *)(base + S21_FILE_HEADER);
+      if (!(mode & S21_MAP_VERIFY) || s21_verify(&header, data)) {
+        for (int i = 0; i < header.rows; i++) {
+          rows[i] = data + (size_t)i * header.stride;
+        }
+        result->matrix = rows;
+        result->data = data;
+        result->rows = header.rows;
+        result->columns = header.columns;
+        result->stride = header.stride;
+        result->flags = S21_MAPPED;
+        if (!(mode & S21_MAP_PRIVATE)) result->flags |= S21_READONLY;
+        err_code = OK;
+      }
+    }
+    if (err_code != OK) {
+      if (base != MAP_FAILED) munmap(base, length);
+      free(rows);
+    }
+  }
+  if (fd >= 0) close(fd);
+  return err_code;
+}
+
+void s21_unmap_matrix(matrix_t *A) {
+  munmap((unsigned char *)A->data - S21_FILE_HEADER,
+         s21_mapped_bytes(A->rows, A->stride));
+}
@@ -0,0 +1,227 @@
+#include <float.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "s21_internal.h"
+
+double *s21_alloc_block(size_t count) {
+  double *block = NULL;
+  size_t per_line = S21_ALIGNMENT / sizeof(double);
+  if (count > 0 && count <= SIZE_MAX / sizeof(double) - per_line) {
+    count = (count + per_line - 1) / per_line * per_line;
+    block = (double *)aligned_alloc(S21_ALIGNMENT, count * sizeof(double));
+  }
+  return block;
+}
+
+void s21_copy_matrix(matrix_t *A, matrix_t *result) {
+  for (int i = 0; i < A->rows; i++) {
+    memcpy(result->matrix[i], A->matrix[i], A->columns * sizeof(double));
+  }
+}
+
+double s21_max_abs(matrix_t *A) {
+  double max_abs = 0;
+  for (int i = 0; i < A->rows; i++) {
+    for (int j = 0; j < A->columns; j++) {
+      double value = fabs(A->matrix[i][j]);
+      if (value > max_abs) max_abs = value;
+    }
+  }
+  return max_abs;
+}
+
+size_t s21_lu_scratch_bytes(int n) {
+  return s21_matrix_bytes(n, n) + s21_align_bytes(n * sizeof(int));
+}
+
+double s21_lu_tolerance(int n, double max_abs) {
+  return n * DBL_EPSILON * max_abs;
+}
+
+static void s21_swap_rows(double **a, int n, int r1, int r2) {
+  double *x = a[r1];
+  double *y = a[r2];
+  for (int j = 0; j < n; j++) {
+    double tmp = x[j];
+    x[j] = y[j];
+    y[j] = tmp;
+  }
+}
+
+static int s21_lu_panel(double **a, int n, int k0, int kb, int *piv) {
+  int sign = 1;
+  for (int k = k0; k < k0 + kb; k++) {
+    int p = k;
+    double best = fabs(a[k][k]);
+    for (int i = k + 1; i < n; i++) {
+      double value = fabs(a[i][k]);
+      if (value > best) {
+        best = value;
+        p = i;
+      }
+    }
+    piv[k] = p;
+    if (p != k) {
+      s21_swap_rows(a, n, k, p);
+      sign = -sign;
+    }
+    const double *row_k = a[k];
+    if (row_k[k] != 0) {
+      double inv = 1.0 / row_k[k];
+      for (int i = k + 1; i < n; i++) {
+        double *row_i = a[i];
+        double l = row_i[k] *= inv;
+        for (int j = k + 1; j < k0 + kb; j++) row_i[j] -= l * row_k[j];
+      }
+    }
+  }
+  return sign;
+}
+
+int s21_lu_factor(double **a, int n, int *piv) {
+  int sign = 1;
+  for (int k0 = 0; k0 < n; k0 += S21_LU_BLOCK) {
+    int kb = n - k0 < S21_LU_BLOCK ? n - k0 : S21_LU_BLOCK;
+    int j0 = k0 + kb;
+    sign *= s21_lu_panel(a, n, k0, kb, piv);
+    if (j0 < n) {
+      for (int k = k0; k < j0; k++) {
+        const double *row_k = a[k];
+        for (int i = k + 1; i < j0; i++) {
+          double *row_i = a[i];
+          double l = row_i[k];
+          for (int j = j0; j < n; j++) row_i[j] -= l * row_k[j];
+        }
+      }
+      s21_dgemm(0, 0, n - j0, n - j0, kb, -1.0, a + j0, k0, a + k0, j0, 1.0,
+                a + j0, j0);
+    }
+  }
+  return sign;
+}
+
+static int s21_lu_pivot_ok(double **a, int n, int k) {
+  double pivot = fabs(a[k][k]);
+  double bound = pivot;
+  for (int j = 0; j < k; j++) bound += fabs(a[k][j] * a[j][k]);
+  return pivot > n * DBL_EPSILON * bound;
+}
+
+int s21_lu_rank(double **a, int n) {
+  int rank = 0;
+  while (rank < n && s21_lu_pivot_ok(a, n, rank)) rank++;
+  return rank;
+}
+
+double s21_lu_det(double **a, int n, int sign) {
+  double det = 0;
+  if (s21_lu_rank(a, n) == n) {
+    det = sign;
+    for (int k = 0; k < n; k++) det *= a[k][k];
+  }
+  return det;
+}
+
+int s21_lu_is_singular(double **a, int n) { return s21_lu_rank(a, n) < n; }
+
+void s21_lu_permute(const int *piv, int n, double **b, int nrhs) {
+  for (int k = 0; k < n; k++) {
+    if (piv[k] != k) s21_swap_rows(b, nrhs, k, piv[k]);
+  }
+}
+
+void s21_lu_permute_back(const int *piv, int n, double **b, int nrhs) {
+  for (int k = n - 1; k >= 0; k--) {
+    if (piv[k] != k) s21_swap_rows(b, nrhs, k, piv[k]);
+  }
+}
+
+void s21_lu_solve(double **lu, int n, double **b, int nrhs) {
+  s21_trsm(S21_LOWER, S21_NO_TRANS, 1, n, lu, 0, nrhs, b, 0);
+  s21_trsm(S21_UPPER, S21_NO_TRANS, 0, n, lu, 0, nrhs, b, 0);
+}
+
+void s21_lu_inverse(double **lu, const int *piv, int n, double **result) {
+  for (int i = 0; i < n; i++) {
+    memset(result[i], 0, n * sizeof(double));
+    result[i][i] = 1.0;
+  }
+  for (int j0 = 0; j0 < n; j0 += S21_LU_BLOCK) {
+    int jn = n - j0 < S21_LU_BLOCK ? n - j0 : S21_LU_BLOCK;
+    s21_trsm(S21_LOWER, S21_NO_TRANS, 1, n - j0, lu + j0, j0, jn, result + j0,
+             j0);
+  }
+  s21_trsm(S21_UPPER, S21_NO_TRANS, 0, n, lu, 0, n, result, 0);
+  for (int k = n - 1; k >= 0; k--) {
+    int p = piv[k];
+    for (int i = 0; i < n && p != k; i++) {
+      double tmp = result[i][k];
+      result[i][k] = result[i][p];
+      result[i][p] = tmp;
+    }
+  }
+}
+
+static void s21_swap_columns(double **a, int n, int c1, int c2) {
+  for (int i = 0; i < n; i++) {
+    double tmp = a[i][c1];
+    a[i][c1] = a[i][c2];
+    a[i][c2] = tmp;
+  }
+}
+
+void s21_lu_full(double **a, int n, int *prow, int *pcol) {
+  int p = 0;
+  int q = 0;
+  double best = -1;
+  for (int i = 0; i < n; i++) {
+    for (int j = 0; j < n; j++) {
+      if (fabs(a[i][j]) > best) {
+        best = fabs(a[i][j]);
+        p = i;
+        q = j;
+      }
+    }
+  }
+  for (int k = 0; k < n; k++) {
+    prow[k] = k;
+    pcol[k] = k;
+  }
+  for (int k = 0; k < n && best > 0; k++) {
+    prow[k] = p;
+    pcol[k] = q;
+    if (p != k) s21_swap_rows(a, n, k, p);
+    if (q != k) s21_swap_columns(a, n, k, q);
+    const double *row_k = a[k];
+    double inv = 1.0 / row_k[k];
+    best = -1;
+    for (int i = k + 1; i < n; i++) {
+      double *row_i = a[i];
+      double l = row_i[k] *= inv;
+      for (int j = k + 1; j < n; j++) {
+        row_i[j] -= l * row_k[j];
+        if (fabs(row_i[j]) > best) {
+          best = fabs(row_i[j]);
+          p = i;
+          q = j;
+        }
+      }
+    }
+  }
+}
+
+void s21_lu_unpermute(const int *prow, const int *pcol, int n, double **b) {
+  for (int k = n - 1; k >= 0; k--) {
+    if (prow[k] != k) s21_swap_rows(b, n, k, prow[k]);
+    if (pcol != NULL && pcol[k] != k) s21_swap_columns(b, n, k, pcol[k]);
+  }
+}
+
+int s21_lu_parity(const int *piv, int n) {
+  int sign = 1;
+  for (int k = 0; k < n; k++) {
+    if (piv[k] != k) sign = -sign;
+  }
+  return sign;
+}
@@ -1,23 +1,45 @@
-#include "s21_matrix.h"
+#include <limits.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "s21_internal.h"
+
+int s21_row_stride(int columns) {
+  int per_line = S21_ALIGNMENT / (int)sizeof(double);
+  return (columns + per_line - 1) / per_line * per_line;
+}
 
 int s21_create_matrix(int rows, int columns, matrix_t *result) {
   int err_code = OK;
-  if (rows < 1 || columns < 1) {
+  if (rows < 1 || columns < 1 || columns > INT_MAX - S21_ALIGNMENT) {
     err_code = INCORRECT_MATRIX;
   } else {
-    result->matrix = (double **)calloc(rows, sizeof(double));
+    int stride = s21_row_stride(columns);
+    size_t count = (size_t)rows * (size_t)stride;
+    result->matrix = NULL;
+    result->data = NULL;
     result->rows = rows;
     result->columns = columns;
-    if (result->matrix != NULL) {
+    result->stride = stride;
+    result->flags = 0;
+    if (count <= SIZE_MAX / sizeof(double)) {
+      result->matrix = (double **)malloc(rows * sizeof(double *));
+      result->data =
+          (double *)aligned_alloc(S21_ALIGNMENT, count * sizeof(double));
+    }
+    if (result->matrix != NULL && result->data != NULL) {
+      memset(result->data, 0, count * sizeof(double));
       for (int i = 0; i < rows; i++) {
-        result->matrix[i] = (double *)calloc(columns, sizeof(double));
-        if (result->matrix[i] == NULL) {
-          s21_remove_matrix(result);
-          err_code = INCORRECT_MATRIX;
-        }
+        result->matrix[i] = result->data + (size_t)i * stride;
       }
     } else {
-      s21_remove_matrix(result);
+      free(result->matrix);
+      free(result->data);
+      result->matrix = NULL;
+      result->data = NULL;
+      result->rows = 0;
+      result->columns = 0;
+      result->stride = 0;
       err_code = INCORRECT_MATRIX;
     }
   }
@@ -26,25 +48,53 @@ int s21_create_matrix(int rows, int columns, matrix_t *result) {
 
 void s21_remove_matrix(matrix_t *A) {
   if (A) {
-    for (int i = 0; i < A->rows; i++) {
-      free(A->matrix[i]);
+    if (A->flags & S21_MAPPED) {
+      s21_unmap_matrix(A);
+      free(A->matrix);
+    } else if (A->flags & S21_VIEW) {
+      free(A->matrix);
+    } else if (!(A->flags & S21_BORROWED)) {
+      if (A->data != NULL) {
+        free(A->data);
+      } else if (A->matrix != NULL) {
+        for (int i = 0; i < A->rows; i++) {
+          free(A->matrix[i]);
+        }
+      }
+      free(A->matrix);
     }
-    free(A->matrix);
     A->matrix = NULL;
+    A->data = NULL;
     A->columns = 0;
     A->rows = 0;
+    A->stride = 0;
+    A->flags = 0;
   }
 }
 
+static int s21_eq_lazy(matrix_t *A, matrix_t *B) {
+  s21_scratch_t scratch;
+  int lazy = s21_is_lazy(A);
+  int err_code = FAILURE;
+  if (s21_scratch_open(&scratch, s21_orient_bytes(B, lazy)) == OK) {
+    matrix_t a, b;
+    s21_storage(A, &a);
+    s21_orient(B, lazy, scratch.arena, &b);
+    err_code = s21_eq_matrix(&a, &b);
+  }
+  s21_scratch_close(&scratch);
+  return err_code;
+}
+
 int s21_eq_matrix(matrix_t *A, matrix_t *B) {
   if (!s21_is_matrix_ok(A) || !s21_is_matrix_ok(B) || A->rows != B->rows ||
       A->columns != B->columns)
     return FAILURE;
+  if (s21_is_lazy(A) || s21_is_lazy(B)) return s21_eq_lazy(A, B);
+  const s21_kernels_t *kernels = s21_kernels();
   int err_code = SUCCESS;
   for (int i = 0; i < A->rows && err_code; i++) {
-    for (int j = 0; j < A->columns && err_code; j++) {
-      if (fabs(A->matrix[i][j] - B->matrix[i][j]) > 1e-7) err_code = FAILURE;
-    }
+    err_code = kernels->eq(A->columns, A->matrix[i], B->matrix[i], 1e-7);
   }
   return err_code;
 }
@@ -58,18 +108,88 @@ int s21_is_matrix_ok(matrix_t *matrix) {
   return err_code;
 }
 
-int s21_sum_matrix(matrix_t *A, matrix_t *B, matrix_t *result) {
+static int s21_same_shape(matrix_t *A, matrix_t *B) {
+  return A->rows == B->rows && A->columns == B->columns;
+}
+
+static void s21_row_range(matrix_t *A, const double **lo, const double **hi) {
+  *lo = A->matrix[0];
+  *hi = A->matrix[0] + A->columns;
+  for (int i = 1; i < A->rows; i++) {
+    if (A->matrix[i] < *lo) *lo = A->matrix[i];
+    if (A->matrix[i] + A->columns > *hi) *hi = A->matrix[i] + A->columns;
+  }
+}
+
+static int s21_rows_ascending(matrix_t *A) {
+  int ascending = 1;
+  for (int i = 1; i < A->rows && ascending; i++) {
+    ascending = A->matrix[i - 1] + A->columns <= A->matrix[i];
+  }
+  return ascending;
+}
+
+int s21_overlaps(matrix_t *A, matrix_t *B) {
+  matrix_t a, b;
+  s21_storage(A, &a);
+  s21_storage(B, &b);
+  A = &a;
+  B = &b;
+  const double *a_lo, *a_hi, *b_lo, *b_hi;
+  s21_row_range(A, &a_lo, &a_hi);
+  s21_row_range(B, &b_lo, &b_hi);
+  int overlap = a_lo < b_hi && b_lo < a_hi;
+  if (overlap && s21_rows_ascending(A) && s21_rows_ascending(B)) {
+    int i = 0, j = 0;
+    overlap = 0;
+    while (i < A->rows && j < B->rows && !overlap) {
+      if (A->matrix[i] + A->columns <= B->matrix[j]) {
+        i++;
+      } else if (B->matrix[j] + B->columns <= A->matrix[i]) {
+        j++;
+      } else {
+        overlap = 1;
+      }
+    }
+  }
+  return overlap;
+}
+
+typedef void (*s21_binary_fn)(int n, const double *a, const double *b,
+                              double *out);
+
+static int s21_binary_lazy(matrix_t *A, matrix_t *B, matrix_t *result,
+                           s21_binary_fn fn) {
+  s21_scratch_t scratch;
+  int lazy = s21_is_lazy(result);
+  size_t bytes = s21_orient_bytes(A, lazy) + s21_orient_bytes(B, lazy);
+  int err_code = s21_scratch_open(&scratch, bytes);
+  if (err_code == OK) {
+    matrix_t a, b, r;
+    s21_orient(A, lazy, scratch.arena, &a);
+    s21_orient(B, lazy, scratch.arena, &b);
+    s21_storage(result, &r);
+    for (int i = 0; i < r.rows; i++) {
+      fn(r.columns, a.matrix[i], b.matrix[i], r.matrix[i]);
+    }
+  }
+  s21_scratch_close(&scratch);
+  return err_code;
+}
+
+static int s21_binary_into(matrix_t *A, matrix_t *B, matrix_t *result,
+                           s21_binary_fn fn) {
   int err_code = OK;
-  if (s21_is_matrix_ok(A) && s21_is_matrix_ok(B)) {
-    if (A->rows == B->rows && A->columns == B->columns) {
-      s21_create_matrix(A->rows, A->columns, result);
+  if (s21_is_matrix_ok(A) && s21_is_matrix_ok(B) && s21_is_matrix_ok(result) &&
+      s21_is_writable(result)) {
+    if (!s21_same_shape(A, B) || !s21_same_shape(A, result)) {
+      err_code = CALCULATION_ERROR;
+    } else if (s21_is_lazy(A) || s21_is_lazy(B) || s21_is_lazy(result)) {
+      err_code = s21_binary_lazy(A, B, result, fn);
+    } else {
       for (int i = 0; i < A->rows; i++) {
-        for (int j = 0; j < A->columns; j++) {
-          result->matrix[i][j] = A->matrix[i][j] + B->matrix[i][j];
-        }
+        fn(A->columns, A->matrix[i], B->matrix[i], result->matrix[i]);
       }
-    } else {
-      err_code = CALCULATION_ERROR;
     }
   } else {
     err_code = INCORRECT_MATRIX;
@@ -77,16 +197,13 @@ int s21_sum_matrix(matrix_t *A, matrix_t *B, matrix_t *result) {
   return err_code;
 }
 
-int s21_sub_matrix(matrix_t *A, matrix_t *B, matrix_t *result) {
+static int s21_binary(matrix_t *A, matrix_t *B, matrix_t *result,
+                      s21_binary_fn fn) {
   int err_code = OK;
   if (s21_is_matrix_ok(A) && s21_is_matrix_ok(B)) {
-    if (A->rows == B->rows && A->columns == B->columns) {
-      s21_create_matrix(A->rows, A->columns, result);
-      for (int i = 0; i < A->rows; i++) {
-        for (int j = 0; j < A->columns; j++) {
-          result->matrix[i][j] = A->matrix[i][j] - B->matrix[i][j];
-        }
-      }
+    if (s21_same_shape(A, B)) {
+      err_code = s21_create_matrix(A->rows, A->columns, result);
+      if (err_code == OK) err_code = s21_binary_into(A, B, result, fn);
     } else {
       err_code = CALCULATION_ERROR;
     }
@@ -96,13 +213,60 @@ int s21_sub_matrix(matrix_t *A, matrix_t *B, matrix_t *result) {
   return err_code;
 }
 
+int s21_sum_matrix(matrix_t *A, matrix_t *B, matrix_t *result) {
+  return s21_binary(A, B, result, s21_kernels()->add);
+}
+
+int s21_sum_matrix_into(matrix_t *A, matrix_t *B, matrix_t *result) {
+  return s21_binary_into(A, B, result, s21_kernels()->add);
+}
+
+int s21_sub_matrix(matrix_t *A, matrix_t *B, matrix_t *result) {
+  return s21_binary(A, B, result, s21_kernels()->sub);
+}
+
+int s21_sub_matrix_into(matrix_t *A, matrix_t *B, matrix_t *result) {
+  return s21_binary_into(A, B, result, s21_kernels()->sub);
+}
+
 int s21_mult_number(matrix_t *A, double number, matrix_t *result) {
   int err_code = OK;
   if (s21_is_matrix_ok(A)) {
-    s21_create_matrix(A->rows, A->columns, result);
-    for (int i = 0; i < A->rows; i++) {
-      for (int j = 0; j < A->columns; j++) {
-        result->matrix[i][j] = A->matrix[i][j] * number;
+    err_code = s21_create_matrix(A->rows, A->columns, result);
+    if (err_code == OK) err_code = s21_mult_number_into(A, number, result);
+  } else {
+    err_code = INCORRECT_MATRIX;
+  }
+  return err_code;
+}
+
+static int s21_mult_number_lazy(matrix_t *A, double number,
+                                matrix_t *result) {
+  s21_scratch_t scratch;
+  int lazy = s21_is_lazy(result);
+  int err_code = s21_scratch_open(&scratch, s21_orient_bytes(A, lazy));
+  if (err_code == OK) {
+    matrix_t a, r;
+    s21_orient(A, lazy, scratch.arena, &a);
+    s21_storage(result, &r);
+    err_code = s21_mult_number_into(&a, number, &r);
+  }
+  s21_scratch_close(&scratch);
+  return err_code;
+}
+
+int s21_mult_number_into(matrix_t *A, double number, matrix_t *result) {
+  int err_code = OK;
+  if (s21_is_matrix_ok(A) && s21_is_matrix_ok(result) &&
+      s21_is_writable(result)) {
+    if (!s21_same_shape(A, result)) {
+      err_code = CALCULATION_ERROR;
+    } else if (s21_is_lazy(A) || s21_is_lazy(result)) {
+      err_code = s21_mult_number_lazy(A, number, result);
+    } else {
+      const s21_kernels_t *kernels = s21_kernels();
+      for (int i = 0; i < A->rows; i++) {
+        kernels->scale(A->columns, A->matrix[i], number, result->matrix[i]);
       }
     }
   } else {
@@ -115,14 +279,8 @@ int s21_mult_matrix(matrix_t *A, matrix_t *B, matrix_t *result) {
   int err_code = OK;
   if (s21_is_matrix_ok(A) && s21_is_matrix_ok(B)) {
     if (A->columns == B->rows) {
-      s21_create_matrix(A->rows, B->columns, result);
-      for (int i = 0; i < A->rows; i++) {
-        for (int j = 0; j < B->columns; j++) {
-          for (int k = 0; k < B->rows; k++) {
-            result->matrix[i][j] += A->matrix[i][k] * B->matrix[k][j];
-          }
-        }
-      }
+      err_code = s21_create_matrix(A->rows, B->columns, result);
+      if (err_code == OK) err_code = s21_mult_matrix_into(A, B, result);
     } else {
       err_code = CALCULATION_ERROR;
     }
@@ -132,30 +290,90 @@ int s21_mult_matrix(matrix_t *A, matrix_t *B, matrix_t *result) {
   return err_code;
 }
 
-static void s21_fill_transpose(matrix_t *A, matrix_t *result) {
-  for (int i = 0; i < A->rows; i++) {
-    for (int j = 0; j < A->columns; j++) {
-      result->matrix[j][i] = A->matrix[i][j];
-    }
-  }
+int s21_mult_matrix_into(matrix_t *A, matrix_t *B, matrix_t *result) {
+  return s21_gemm(S21_NO_TRANS, S21_NO_TRANS, 1.0, A, B, 0.0, result);
 }
 
 int s21_transpose(matrix_t *A, matrix_t *result) {
   int err_code = OK;
   if (s21_is_matrix_ok(A)) {
-    s21_create_matrix(A->columns, A->rows, result);
+    err_code = s21_create_matrix(A->columns, A->rows, result);
+    if (err_code == OK) err_code = s21_transpose_into(A, result);
+  } else {
+    err_code = INCORRECT_MATRIX;
+  }
+  return err_code;
+}
+
+static void s21_fill_oriented(matrix_t *A, matrix_t *result, int same) {
+  if (same) {
+    s21_copy_matrix(A, result);
+  } else {
     s21_fill_transpose(A, result);
+  }
+}
+
+int s21_transpose_into(matrix_t *A, matrix_t *result) {
+  int err_code = OK;
+  if (s21_is_matrix_ok(A) && s21_is_matrix_ok(result) &&
+      s21_is_writable(result)) {
+    if (result->rows == A->columns && result->columns == A->rows) {
+      matrix_t a, r;
+      int same = s21_is_lazy(A) != s21_is_lazy(result);
+      s21_storage(A, &a);
+      s21_storage(result, &r);
+      if (r.matrix == a.matrix && (same || a.rows == a.columns)) {
+        if (!same) s21_transpose_square(&a);
+      } else if (s21_overlaps(&r, &a)) {
+        s21_scratch_t scratch;
+        matrix_t copy = {0};
+        size_t bytes = s21_matrix_bytes(r.rows, r.columns);
+        err_code = s21_scratch_open(&scratch, bytes);
+        if (err_code == OK) {
+          s21_create_matrix_arena(r.rows, r.columns, scratch.arena, &copy);
+          s21_fill_oriented(&a, &copy, same);
+          s21_copy_matrix(&copy, &r);
+        }
+        s21_scratch_close(&scratch);
+      } else {
+        s21_fill_oriented(&a, &r, same);
+      }
+    } else {
+      err_code = CALCULATION_ERROR;
+    }
   } else {
     err_code = INCORRECT_MATRIX;
   }
   return err_code;
 }
 
+static double s21_lu_determinant(matrix_t *A, int *err_code) {
+  int n = A->rows;
+  double result = 0;
+  s21_scratch_t scratch;
+  if (s21_scratch_open(&scratch, s21_lu_scratch_bytes(n)) == OK) {
+    matrix_t lu = {0};
+    s21_create_matrix_arena(n, n, scratch.arena, &lu);
+    int *piv = (int *)s21_arena_alloc(scratch.arena, n * sizeof(int));
+    s21_copy_matrix(A, &lu);
+    int sign = s21_lu_factor(lu.matrix, n, piv);
+    result = s21_lu_det(lu.matrix, n, sign);
+  } else {
+    *err_code = CALCULATION_ERROR;
+  }
+  s21_scratch_close(&scratch);
+  return result;
+}
+
 int s21_determinant(matrix_t *A, double *result) {
   int err_code = OK;
   if (A->rows == A->columns) {
     if (s21_is_matrix_ok(A)) {
-      *result = s21_recursion_det(A);
+      if (A->rows <= S21_SMALL_MAX) {
+        *result = s21_det_small(A);
+      } else if (!s21_chol_candidate(A) || s21_chol_det(A, result) != OK) {
+        *result = s21_lu_determinant(A, &err_code);
+      }
     } else {
       err_code = INCORRECT_MATRIX;
     }
@@ -165,28 +383,66 @@ int s21_determinant(matrix_t *A, double *result) {
   return err_code;
 }
 
-double s21_recursion_det(matrix_t *A) {
+int s21_determinant_exact(matrix_t *A, double *result) {
+  int err_code = OK;
+  if (!s21_is_matrix_ok(A)) {
+    err_code = INCORRECT_MATRIX;
+  } else if (A->rows != A->columns || A->rows > S21_EXACT_DET_MAX) {
+    err_code = CALCULATION_ERROR;
+  } else {
+    *result = s21_recursion_det(A);
+  }
+  return err_code;
+}
+
+static double s21_recursion_det_arena(matrix_t *A, arena_t *arena) {
   double result = 0;
   if (A->columns == 1) {
     result = A->matrix[0][0];
   } else if (A->columns == 2) {
     result =
         A->matrix[0][0] * A->matrix[1][1] - A->matrix[1][0] * A->matrix[0][1];
+  } else if (A->rows == A->columns && A->rows <= S21_SMALL_MAX) {
+    result = s21_det_small(A);
   } else {
     if (A->rows != 1 && A->rows != 2) {
       result = 0;
-      matrix_t temp_m = {0};
-      s21_create_matrix(A->rows - 1, A->columns - 1, &temp_m);
+      size_t mark = s21_arena_mark(arena);
+      matrix_t minor = {0};
+      minor.rows = A->rows - 1;
+      minor.columns = A->columns - 1;
+      minor.matrix =
+          (double **)s21_arena_alloc(arena, minor.rows * sizeof(double *));
+      minor.flags = S21_BORROWED;
       for (int i = 0; i < A->rows; i++) {
-        s21_fill_matrix(0, i, A, &temp_m);
-        result += pow(-1, i) * A->matrix[0][i] * s21_recursion_det(&temp_m);
+        s21_minor_rows(A, i, 1, minor.matrix);
+        result += pow(-1, i) * A->matrix[i][0] *
+                  s21_recursion_det_arena(&minor, arena);
       }
-      s21_remove_matrix(&temp_m);
+      s21_arena_release(arena, mark);
     }
   }
   return result;
 }
 
+double s21_recursion_det(matrix_t *A) {
+  double result = 0;
+  if (A->rows <= 2) {
+    result = s21_recursion_det_arena(A, NULL);
+  } else {
+    size_t bytes = 0;
+    for (int k = 2; k < A->rows; k++) {
+      bytes += s21_align_bytes(k * sizeof(double *));
+    }
+    s21_scratch_t scratch;
+    if (s21_scratch_open(&scratch, bytes) == OK) {
+      result = s21_recursion_det_arena(A, scratch.arena);
+    }
+    s21_scratch_close(&scratch);
+  }
+  return result;
+}
+
 void s21_fill_matrix(int rws, int clmns, matrix_t *A, matrix_t *result) {
   int r = 0;
   int c = 0;
@@ -206,6 +462,58 @@ void s21_fill_matrix(int rws, int clmns, matrix_t *A, matrix_t *result) {
   }
 }
 
+static void s21_adjugate_t(double **lu, int n, int sign, double **result) {
+  double d = lu[n - 1][n - 1];
+  double scale = sign;
+  for (int i = 0; i < n - 1; i++) {
+    memset(result[i], 0, (n - 1) * sizeof(double));
+    result[i][i] = d;
+    result[i][n - 1] = -lu[i][n - 1];
+    scale *= lu[i][i];
+  }
+  memset(result[n - 1], 0, (n - 1) * sizeof(double));
+  result[n - 1][n - 1] = 1.0;
+  s21_trsm(S21_UPPER, S21_NO_TRANS, 0, n - 1, lu, 0, n, result, 0);
+  matrix_t adj = {result, n, n, NULL, 0, S21_BORROWED};
+  s21_transpose_square(&adj);
+  s21_trsm(S21_LOWER, S21_TRANS, 1, n, lu, 0, n, result, 0);
+  const s21_kernels_t *kernels = s21_kernels();
+  for (int i = 0; i < n; i++) kernels->scale(n, result[i], scale, result[i]);
+}
+
+static int s21_fill_complements(matrix_t *A, matrix_t *result) {
+  int n = A->rows;
+  s21_scratch_t scratch;
+  size_t bytes = s21_lu_scratch_bytes(n) + s21_align_bytes(n * sizeof(int));
+  int err_code = s21_scratch_open(&scratch, bytes);
+  if (err_code == OK) {
+    matrix_t lu = {0};
+    s21_create_matrix_arena(n, n, scratch.arena, &lu);
+    int *prow = (int *)s21_arena_alloc(scratch.arena, n * sizeof(int));
+    int *pcol = NULL;
+    s21_copy_matrix(A, &lu);
+    int sign = s21_lu_factor(lu.matrix, n, prow);
+    int rank = n;
+    if (s21_lu_rank(lu.matrix, n) < n - 1) {
+      pcol = (int *)s21_arena_alloc(scratch.arena, n * sizeof(int));
+      s21_copy_matrix(A, &lu);
+      s21_lu_full(lu.matrix, n, prow, pcol);
+      rank = s21_lu_rank(lu.matrix, n);
+      sign = s21_lu_parity(prow, n) * s21_lu_parity(pcol, n);
+    }
+    if (rank < n - 1) {
+      for (int i = 0; i < n; i++) {
+        memset(result->matrix[i], 0, n * sizeof(double));
+      }
+    } else {
+      s21_adjugate_t(lu.matrix, n, sign, result->matrix);
+      s21_lu_unpermute(prow, pcol, n, result->matrix);
+    }
+  }
+  s21_scratch_close(&scratch);
+  return err_code;
+}
+
 int s21_calc_complements(matrix_t *A, matrix_t *result) {
   int err_code = OK;
   if (A->rows == A->columns) {
@@ -213,18 +521,8 @@ int s21_calc_complements(matrix_t *A, matrix_t *result) {
       err_code = CALCULATION_ERROR;
     }
     if (s21_is_matrix_ok(A) && A->rows >= 2) {
-      s21_create_matrix(A->rows, A->columns, result);
-      for (int i = 0; i < A->rows; i++) {
-        for (int j = 0; j < A->columns; j++) {
-          matrix_t minor = {0};
-          double det = 0;
-          s21_create_matrix(A->rows - 1, A->columns - 1, &minor);
-          s21_fill_matrix(i, j, A, &minor);
-          s21_determinant(&minor, &det);
-          result->matrix[i][j] = pow(-1, (i + j)) * det;
-          s21_remove_matrix(&minor);
-        }
-      }
+      err_code = s21_create_matrix(A->rows, A->columns, result);
+      if (err_code == OK) err_code = s21_calc_complements_into(A, result);
     } else {
       err_code = INCORRECT_MATRIX;
     }
@@ -234,30 +532,117 @@ int s21_calc_complements(matrix_t *A, matrix_t *result) {
   return err_code;
 }
 
-int s21_inverse_matrix(matrix_t *A, matrix_t *result) {
-  if (!s21_is_matrix_ok(A)) return INCORRECT_MATRIX;
-  double det = 0;
-  int err_code = s21_determinant(A, &det);
-  if (!err_code && det != 0) {
-    if (A->rows == 1) {
-      err_code = s21_create_matrix(A->rows, A->columns, result);
-      if (!err_code) result->matrix[0][0] = 1 / A->matrix[0][0];
-    } else {
-      matrix_t trancepose_m = {NULL, 0, 0};
-      err_code = s21_transpose(A, &trancepose_m);
-      if (!err_code) {
-        matrix_t calc_m = {NULL, 0, 0};
-        err_code = s21_calc_complements(&trancepose_m, &calc_m);
-        if (!err_code) {
-          err_code = s21_mult_number(&calc_m, 1 / det, result);
-        }
-        s21_remove_matrix(&calc_m);
-      }
-      s21_remove_matrix(&trancepose_m);
+int s21_calc_complements_into(matrix_t *A, matrix_t *result) {
+  int err_code = OK;
+  if (!s21_is_matrix_ok(A) || !s21_is_matrix_ok(result) ||
+      !s21_is_writable(result)) {
+    err_code = INCORRECT_MATRIX;
+  } else if (A->rows != A->columns || A->rows < 2 ||
+             !s21_same_shape(A, result)) {
+    err_code = CALCULATION_ERROR;
+  } else if (A->rows <= S21_SMALL_MAX) {
+    s21_small_complements(A, result);
+  } else if (s21_overlaps(A, result)) {
+    s21_scratch_t scratch;
+    matrix_t copy = {0};
+    err_code = s21_scratch_open(&scratch, s21_matrix_bytes(A->rows, A->rows));
+    if (err_code == OK) {
+      s21_create_matrix_arena(A->rows, A->rows, scratch.arena, &copy);
+      s21_copy_matrix(A, &copy);
+      err_code = s21_fill_complements(&copy, result);
     }
+    s21_scratch_close(&scratch);
   } else {
+    err_code = s21_fill_complements(A, result);
+  }
+  if (err_code == OK && s21_is_lazy(A) != s21_is_lazy(result)) {
+    s21_transpose_square(result);
+  }
+  return err_code;
+}
+
+int s21_inverse_matrix(matrix_t *A, matrix_t *result) {
+  if (!s21_is_matrix_ok(A)) return INCORRECT_MATRIX;
+  int err_code = CALCULATION_ERROR;
+  if (A->rows == A->columns) {
+    err_code = s21_create_matrix(A->rows, A->columns, result);
+    if (err_code == OK) err_code = s21_inverse_matrix_into(A, result);
+  }
+  if (err_code != OK) {
     s21_remove_matrix(result);
     err_code = CALCULATION_ERROR;
   }
   return err_code;
 }
+
+int s21_inverse_matrix_into(matrix_t *A, matrix_t *result) {
+  if (!s21_is_matrix_ok(A) || !s21_is_matrix_ok(result) ||
+      !s21_is_writable(result)) {
+    return INCORRECT_MATRIX;
+  }
+  int err_code = CALCULATION_ERROR;
+  int n = A->rows;
+  if (A->rows == A->columns && s21_same_shape(A, result) &&
+      n <= S21_SMALL_MAX) {
+    err_code = s21_small_inverse(A, result);
+  } else if (A->rows == A->columns && s21_same_shape(A, result) &&
+             s21_chol_candidate(A) && s21_chol_inverse(A, result) == OK) {
+    err_code = OK;
+  } else if (A->rows == A->columns && s21_same_shape(A, result)) {
+    s21_scratch_t scratch;
+    if (s21_scratch_open(&scratch, s21_lu_scratch_bytes(n)) == OK) {
+      matrix_t lu = {0};
+      s21_create_matrix_arena(n, n, scratch.arena, &lu);
+      int *piv = (int *)s21_arena_alloc(scratch.arena, n * sizeof(int));
+      s21_copy_matrix(A, &lu);
+      s21_lu_factor(lu.matrix, n, piv);
+      if (!s21_lu_is_singular(lu.matrix, n)) {
+        s21_lu_inverse(lu.matrix, piv, n, result->matrix);
+        err_code = OK;
+      }
+    }
+    s21_scratch_close(&scratch);
+  }
+  if (err_code == OK && s21_is_lazy(A) != s21_is_lazy(result)) {
+    s21_transpose_square(result);
+  }
+  return err_code;
+}
+
+static int s21_lu_system(matrix_t *A, matrix_t *B, matrix_t *result) {
+  int n = A->rows;
+  int err_code = s21_materialize(B, result);
+  if (err_code == OK) {
+    s21_scratch_t scratch;
+    err_code = s21_scratch_open(&scratch, s21_lu_scratch_bytes(n));
+    if (err_code == OK) {
+      matrix_t lu = {0};
+      s21_create_matrix_arena(n, n, scratch.arena, &lu);
+      int *piv = (int *)s21_arena_alloc(scratch.arena, n * sizeof(int));
+      s21_copy_logical(A, &lu);
+      s21_lu_factor(lu.matrix, n, piv);
+      if (s21_lu_is_singular(lu.matrix, n)) {
+        err_code = CALCULATION_ERROR;
+      } else {
+        s21_lu_permute(piv, n, result->matrix, B->columns);
+        s21_lu_solve(lu.matrix, n, result->matrix, B->columns);
+      }
+    }
+    s21_scratch_close(&scratch);
+    if (err_code != OK) s21_remove_matrix(result);
+  }
+  return err_code;
+}
+
+int s21_solve(matrix_t *A, matrix_t *B, matrix_t *result) {
+  if (!s21_is_matrix_ok(A) || !s21_is_matrix_ok(B)) return INCORRECT_MATRIX;
+  int err_code = CALCULATION_ERROR;
+  if (A->rows == A->columns && B->rows == A->rows) {
+    if (s21_chol_candidate(A) && s21_cholesky_solve(A, B, result) == OK) {
+      err_code = OK;
+    } else {
+      err_code = s21_lu_system(A, B, result);
+    }
+  }
+  return err_code;
+}
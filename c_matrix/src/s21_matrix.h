@@ -7,14 +7,89 @@
 #define SUCCESS 1
 #define FAILURE 0
 
+#define S21_ALIGNMENT 64
+
+#define S21_BORROWED 1
+#define S21_MAPPED 2
+#define S21_VIEW 4
+#define S21_TRANSPOSED 8
+#define S21_READONLY 16
+
+#define S21_MAP_READONLY 0
+#define S21_MAP_PRIVATE 1
+#define S21_MAP_VERIFY 2
+
 enum ERROR_CODE { OK, INCORRECT_MATRIX, CALCULATION_ERROR };
 
+enum S21_TRANSPOSE { S21_NO_TRANS, S21_TRANS };
+
+enum S21_SPARSE_FORMAT { S21_CSR, S21_CSC };
+
+enum S21_FACTOR_KIND {
+  S21_FACTOR_LU,
+  S21_FACTOR_CHOLESKY,
+  S21_FACTOR_LU_FULL
+};
+
+enum S21_SIMD_LEVEL {
+  S21_SIMD_NONE,
+  S21_SIMD_SSE2,
+  S21_SIMD_AVX2,
+  S21_SIMD_AVX512
+};
+
 typedef struct matrix_struct {
   double **matrix;
   int rows;
   int columns;
+  double *data;
+  int stride;
+  int flags;
 } matrix_t;
 
+typedef struct matrixf_struct {
+  float **matrix;
+  int rows;
+  int columns;
+  float *data;
+  int stride;
+  int flags;
+} matrixf_t;
+
+typedef struct sparse_struct {
+  double *values;
+  int *indices;
+  int *offsets;
+  int rows;
+  int columns;
+  int nnz;
+  int format;
+} sparse_t;
+
+typedef struct factor_struct {
+  matrix_t *source;
+  matrix_t lu;
+  int *pivots;
+  int sign;
+  int kind;
+  int rank;
+  int valid;
+} factor_t;
+
+typedef struct batch_struct {
+  double *data;
+  int rows;
+  int columns;
+  int count;
+  int stride;
+} batch_t;
+
+typedef struct arena_struct {
+  unsigned char *base;
+  size_t size;
+  size_t used;
+} arena_t;
+
 int s21_create_matrix(int rows, int columns, matrix_t *result);
 void s21_remove_matrix(matrix_t *A);
 int s21_eq_matrix(matrix_t *A, matrix_t *B);
@@ -23,9 +98,118 @@ int s21_sub_matrix(matrix_t *A, matrix_t *B, matrix_t *result);
 int s21_mult_number(matrix_t *A, double number, matrix_t *result);
 int s21_mult_matrix(matrix_t *A, matrix_t *B, matrix_t *result);
 int s21_transpose(matrix_t *A, matrix_t *result);
+int s21_transpose_lazy(matrix_t *A, matrix_t *result);
+int s21_materialize(matrix_t *A, matrix_t *result);
+int s21_create_view(matrix_t *A, int row, int column, int rows, int columns,
+                    matrix_t *result);
+// Drops a row and a column. The result aliases A (S21_VIEW) only when the
+// column is the first or the last one; otherwise it is an owned copy.
+int s21_create_minor_view(matrix_t *A, int row, int column, matrix_t *result);
+int s21_transpose_inplace(matrix_t *A);
 int s21_calc_complements(matrix_t *A, matrix_t *result);
 int s21_determinant(matrix_t *A, double *result);
+int s21_determinant_exact(matrix_t *A, double *result);
 void s21_fill_matrix(int rws, int clmns, matrix_t *A, matrix_t *result);
 double s21_recursion_det(matrix_t *A);
 int s21_inverse_matrix(matrix_t *A, matrix_t *result);
+int s21_solve(matrix_t *A, matrix_t *B, matrix_t *result);
 int s21_is_matrix_ok(matrix_t *M);
+
+int s21_cholesky(matrix_t *A, matrix_t *result);
+int s21_cholesky_determinant(matrix_t *A, double *result);
+int s21_cholesky_solve(matrix_t *A, matrix_t *B, matrix_t *result);
+int s21_cholesky_inverse(matrix_t *A, matrix_t *result);
+int s21_qr(matrix_t *A, matrix_t *Q, matrix_t *R);
+int s21_least_squares(matrix_t *A, matrix_t *B, matrix_t *result);
+
+int s21_factorize(matrix_t *A, factor_t *result);
+void s21_remove_factor(factor_t *F);
+void s21_invalidate_factor(factor_t *F);
+int s21_factor_determinant(factor_t *F, double *result);
+int s21_factor_inverse(factor_t *F, matrix_t *result);
+int s21_factor_solve(factor_t *F, matrix_t *B, matrix_t *result);
+int s21_factor_rank(factor_t *F, int *result);
+int s21_factor_singular(factor_t *F, int *result);
+
+int s21_sum_matrix_into(matrix_t *A, matrix_t *B, matrix_t *result);
+int s21_sub_matrix_into(matrix_t *A, matrix_t *B, matrix_t *result);
+int s21_mult_number_into(matrix_t *A, double number, matrix_t *result);
+int s21_mult_matrix_into(matrix_t *A, matrix_t *B, matrix_t *result);
+int s21_gemm(int trans_a, int trans_b, double alpha, matrix_t *A, matrix_t *B,
+             double beta, matrix_t *C);
+int s21_transpose_into(matrix_t *A, matrix_t *result);
+int s21_calc_complements_into(matrix_t *A, matrix_t *result);
+int s21_inverse_matrix_into(matrix_t *A, matrix_t *result);
+
+int s21_save_matrix(matrix_t *A, const char *path);
+int s21_map_matrix(const char *path, int mode, matrix_t *result);
+int s21_mult_matrix_file(const char *a_path, const char *b_path,
+                         const char *result_path, size_t budget);
+
+int s21_create_arena(size_t bytes, arena_t *result);
+void s21_remove_arena(arena_t *arena);
+void *s21_arena_alloc(arena_t *arena, size_t bytes);
+size_t s21_arena_mark(arena_t *arena);
+void s21_arena_release(arena_t *arena, size_t mark);
+void s21_arena_reset(arena_t *arena);
+arena_t *s21_bind_arena(arena_t *arena);
+size_t s21_matrix_bytes(int rows, int columns);
+int s21_create_matrix_arena(int rows, int columns, arena_t *arena,
+                            matrix_t *result);
+
+int s21_create_matrix_f(int rows, int columns, matrixf_t *result);
+void s21_remove_matrix_f(matrixf_t *A);
+int s21_eq_matrix_f(matrixf_t *A, matrixf_t *B);
+int s21_sum_matrix_f(matrixf_t *A, matrixf_t *B, matrixf_t *result);
+int s21_sub_matrix_f(matrixf_t *A, matrixf_t *B, matrixf_t *result);
+int s21_mult_number_f(matrixf_t *A, float number, matrixf_t *result);
+int s21_mult_matrix_f(matrixf_t *A, matrixf_t *B, matrixf_t *result);
+int s21_transpose_f(matrixf_t *A, matrixf_t *result);
+int s21_calc_complements_f(matrixf_t *A, matrixf_t *result);
+int s21_determinant_f(matrixf_t *A, double *result);
+int s21_inverse_matrix_f(matrixf_t *A, matrixf_t *result);
+int s21_sum_matrix_into_f(matrixf_t *A, matrixf_t *B, matrixf_t *result);
+int s21_sub_matrix_into_f(matrixf_t *A, matrixf_t *B, matrixf_t *result);
+int s21_mult_number_into_f(matrixf_t *A, float number, matrixf_t *result);
+int s21_mult_matrix_into_f(matrixf_t *A, matrixf_t *B, matrixf_t *result);
+int s21_transpose_into_f(matrixf_t *A, matrixf_t *result);
+int s21_matrix_to_float(matrix_t *A, matrixf_t *result);
+int s21_matrix_to_double(matrixf_t *A, matrix_t *result);
+
+int s21_create_sparse(int rows, int columns, int nnz, int format,
+                      sparse_t *result);
+void s21_remove_sparse(sparse_t *A);
+int s21_sparse_from_triplets(int rows, int columns, int count,
+                             const int *row_idx, const int *col_idx,
+                             const double *values, int format,
+                             sparse_t *result);
+int s21_dense_to_sparse(matrix_t *A, int format, sparse_t *result);
+int s21_sparse_to_dense(sparse_t *A, matrix_t *result);
+int s21_sparse_convert(sparse_t *A, int format, sparse_t *result);
+int s21_sparse_transpose(sparse_t *A, sparse_t *result);
+int s21_sparse_mult_vector(sparse_t *A, const double *x, double *result);
+int s21_sparse_mult_dense(sparse_t *A, matrix_t *B, matrix_t *result);
+int s21_sparse_sum(sparse_t *A, sparse_t *B, sparse_t *result);
+
+int s21_create_batch(int rows, int columns, int count, batch_t *result);
+void s21_remove_batch(batch_t *A);
+int s21_batch_set(batch_t *A, int index, matrix_t *M);
+int s21_batch_get(batch_t *A, int index, matrix_t *result);
+int s21_batch_from_matrices(matrix_t *items, int count, batch_t *result);
+int s21_batch_to_matrices(batch_t *A, matrix_t *result);
+int s21_batch_determinant(batch_t *A, double *result);
+int s21_batch_inverse(batch_t *A, batch_t *result);
+int s21_batch_mult(batch_t *A, batch_t *B, batch_t *result);
+int s21_batch_transpose(batch_t *A, batch_t *result);
+
+int s21_simd_level(void);
+int s21_set_simd_level(int level);
+
+int s21_set_num_threads(int count);
+int s21_get_num_threads(void);
+void s21_set_parallel_threshold(int size);
+void s21_shutdown_threads(void);
+
+int s21_set_strassen_crossover(int size);
+int s21_set_strassen_depth(int levels);
+size_t s21_strassen_workspace(int rows, int inner, int columns, int levels);
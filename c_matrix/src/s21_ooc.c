@@ -0,0 +1,328 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <fcntl.h>
+#include <pthread.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "s21_internal.h"
+
+typedef struct s21_tile {
+  double *data;
+  double **rows;
+  int row0;
+  int col0;
+  int height;
+  int width;
+} s21_tile_t;
+
+typedef struct s21_ooc {
+  int fd[3];
+  s21_file_header_t header[3];
+  int tile;
+  int tiles_m;
+  int tiles_n;
+  int tiles_k;
+  s21_tile_t a[2];
+  s21_tile_t b[2];
+  s21_tile_t c[2];
+} s21_ooc_t;
+
+typedef struct s21_io_job {
+  s21_ooc_t *ooc;
+  int load;
+  int step;
+  s21_tile_t *write;
+  int err_code;
+  pthread_mutex_t lock;
+  pthread_cond_t wake;
+  pthread_cond_t done;
+  pthread_t thread;
+  int pending;
+  int stop;
+} s21_io_job_t;
+
+static int s21_pread_full(int fd, void *buffer, size_t bytes, off_t at) {
+  unsigned char *dst = (unsigned char *)buffer;
+  while (bytes > 0) {
+    ssize_t got = pread(fd, dst, bytes, at);
+    if (got <= 0) return CALCULATION_ERROR;
+    dst += got;
+    bytes -= got;
+    at += got;
+  }
+  return OK;
+}
+
+static int s21_pwrite_full(int fd, const void *buffer, size_t bytes,
+                           off_t at) {
+  const unsigned char *src = (const unsigned char *)buffer;
+  while (bytes > 0) {
+    ssize_t put = pwrite(fd, src, bytes, at);
+    if (put <= 0) return CALCULATION_ERROR;
+    src += put;
+    bytes -= put;
+    at += put;
+  }
+  return OK;
+}
+
+static off_t s21_offset(const s21_file_header_t *header, int row, int col) {
+  return S21_FILE_HEADER +
+         ((off_t)row * header->stride + col) * (off_t)sizeof(double);
+}
+
+static int s21_tile_io(int fd, const s21_file_header_t *header,
+                       s21_tile_t *tile, int store) {
+  int err_code = OK;
+  size_t bytes = (size_t)tile->width * sizeof(double);
+  for (int i = 0; i < tile->height && err_code == OK; i++) {
+    off_t at = s21_offset(header, tile->row0 + i, tile->col0);
+    if (store) {
+      err_code = s21_pwrite_full(fd, tile->rows[i], bytes, at);
+    } else {
+      err_code = s21_pread_full(fd, tile->rows[i], bytes, at);
+    }
+  }
+  return err_code;
+}
+
+static void s21_tile_place(s21_tile_t *tile, int row0, int col0, int height,
+                           int width) {
+  tile->row0 = row0;
+  tile->col0 = col0;
+  tile->height = height;
+  tile->width = width;
+}
+
+static int s21_span(int index, int tile, int size) {
+  return size - index * tile < tile ? size - index * tile : tile;
+}
+
+static void s21_step_tiles(s21_ooc_t *ooc, int step, int slot) {
+  int t = ooc->tile;
+  int kb = step % ooc->tiles_k;
+  int cell = step / ooc->tiles_k;
+  int ib = cell / ooc->tiles_n;
+  int jb = cell % ooc->tiles_n;
+  int m = ooc->header[0].rows;
+  int k = ooc->header[0].columns;
+  int n = ooc->header[1].columns;
+  s21_tile_place(&ooc->a[slot], ib * t, kb * t, s21_span(ib, t, m),
+                 s21_span(kb, t, k));
+  s21_tile_place(&ooc->b[slot], kb * t, jb * t, s21_span(kb, t, k),
+                 s21_span(jb, t, n));
+}
+
+static void s21_io_step(s21_io_job_t *job) {
+  s21_ooc_t *ooc = job->ooc;
+  job->err_code = OK;
+  if (job->write != NULL) {
+    job->err_code = s21_tile_io(ooc->fd[2], &ooc->header[2], job->write, 1);
+  }
+  if (job->load && job->err_code == OK) {
+    int slot = job->step % 2;
+    s21_step_tiles(ooc, job->step, slot);
+    s21_tile_t *a = &ooc->a[slot];
+    s21_tile_t *b = &ooc->b[slot];
+    job->err_code = s21_tile_io(ooc->fd[0], &ooc->header[0], a, 0);
+    if (job->err_code == OK) {
+      job->err_code = s21_tile_io(ooc->fd[1], &ooc->header[1], b, 0);
+    }
+  }
+}
+
+static void *s21_io_worker(void *arg) {
+  s21_io_job_t *job = (s21_io_job_t *)arg;
+  pthread_mutex_lock(&job->lock);
+  while (!job->stop) {
+    if (!job->pending) {
+      pthread_cond_wait(&job->wake, &job->lock);
+    } else {
+      pthread_mutex_unlock(&job->lock);
+      s21_io_step(job);
+      pthread_mutex_lock(&job->lock);
+      job->pending = 0;
+      pthread_cond_signal(&job->done);
+    }
+  }
+  pthread_mutex_unlock(&job->lock);
+  return NULL;
+}
+
+static void s21_io_destroy(s21_io_job_t *job) {
+  pthread_mutex_destroy(&job->lock);
+  pthread_cond_destroy(&job->wake);
+  pthread_cond_destroy(&job->done);
+}
+
+static int s21_io_start(s21_io_job_t *job) {
+  pthread_mutex_init(&job->lock, NULL);
+  pthread_cond_init(&job->wake, NULL);
+  pthread_cond_init(&job->done, NULL);
+  int started = pthread_create(&job->thread, NULL, s21_io_worker, job) == 0;
+  if (!started) s21_io_destroy(job);
+  return started;
+}
+
+static void s21_io_stop(s21_io_job_t *job) {
+  pthread_mutex_lock(&job->lock);
+  job->stop = 1;
+  pthread_cond_signal(&job->wake);
+  pthread_mutex_unlock(&job->lock);
+  pthread_join(job->thread, NULL);
+  s21_io_destroy(job);
+}
+
+static void s21_io_post(s21_io_job_t *job) {
+  pthread_mutex_lock(&job->lock);
+  job->pending = 1;
+  pthread_cond_signal(&job->wake);
+  pthread_mutex_unlock(&job->lock);
+}
+
+static void s21_io_wait(s21_io_job_t *job) {
+  pthread_mutex_lock(&job->lock);
+  while (job->pending) pthread_cond_wait(&job->done, &job->lock);
+  pthread_mutex_unlock(&job->lock);
+}
+
+static int s21_tile_alloc(s21_tile_t *tile, int size) {
+  int stride = s21_row_stride(size);
+  tile->data = s21_alloc_block((size_t)size * stride);
+  tile->rows = (double **)malloc(size * sizeof(double *));
+  int err_code = tile->data && tile->rows ? OK : CALCULATION_ERROR;
+  for (int i = 0; i < size && err_code == OK; i++) {
+    tile->rows[i] = tile->data + (size_t)i * stride;
+  }
+  return err_code;
+}
+
+static void s21_tile_free(s21_tile_t *tile) {
+  free(tile->data);
+  free(tile->rows);
+}
+
+static int s21_ooc_tile(size_t budget, int m, int k, int n) {
+  int tile = 0;
+  int per_line = S21_ALIGNMENT / sizeof(double);
+  size_t limit = budget / (6 * sizeof(double) + sizeof(double *));
+  while ((size_t)(tile + per_line) * (tile + per_line) <= limit) {
+    tile += per_line;
+  }
+  int largest = m > k ? m : k;
+  largest = largest > n ? largest : n;
+  largest = s21_row_stride(largest);
+  return tile < largest ? tile : largest;
+}
+
+static int s21_ooc_run(s21_ooc_t *ooc) {
+  int steps = ooc->tiles_m * ooc->tiles_n * ooc->tiles_k;
+  int current = 0;
+  s21_io_job_t job = {.ooc = ooc, .load = 1};
+  s21_io_step(&job);
+  int err_code = job.err_code;
+  int threaded = err_code == OK && steps > 1 && s21_io_start(&job);
+  for (int step = 0; step < steps && err_code == OK; step++) {
+    int slot = step % 2;
+    job.load = step + 1 < steps;
+    job.step = step + 1;
+    if (threaded) {
+      s21_io_post(&job);
+    } else {
+      s21_io_step(&job);
+    }
+    s21_tile_t *a = &ooc->a[slot];
+    s21_tile_t *b = &ooc->b[slot];
+    s21_tile_t *c = &ooc->c[current];
+    int kb = step % ooc->tiles_k;
+    if (kb == 0) s21_tile_place(c, a->row0, b->col0, a->height, b->width);
+    s21_dgemm(S21_NO_TRANS, S21_NO_TRANS, a->height, b->width, a->width, 1.0,
+              a->rows, 0, b->rows, 0, kb == 0 ? 0.0 : 1.0, c->rows, 0);
+    if (threaded) s21_io_wait(&job);
+    err_code = job.err_code;
+    job.write = NULL;
+    if (kb + 1 == ooc->tiles_k) {
+      job.write = c;
+      current ^= 1;
+    }
+  }
+  if (threaded) s21_io_stop(&job);
+  if (err_code == OK && job.write != NULL) {
+    err_code = s21_tile_io(ooc->fd[2], &ooc->header[2], job.write, 1);
+  }
+  return err_code;
+}
+
+static int s21_ooc_checksum(s21_ooc_t *ooc) {
+  s21_file_header_t *header = &ooc->header[2];
+  double *row = s21_alloc_block(header->stride);
+  int err_code = row ? OK : CALCULATION_ERROR;
+  size_t bytes = (size_t)header->stride * sizeof(double);
+  for (int i = 0; i < header->rows && err_code == OK; i++) {
+    err_code = s21_pread_full(ooc->fd[2], row, bytes, s21_offset(header, i, 0));
+    header->checksum =
+        header->checksum * 31 + s21_checksum(row, header->stride);
+  }
+  if (err_code == OK) {
+    err_code = s21_pwrite_full(ooc->fd[2], header, sizeof(*header), 0);
+  }
+  free(row);
+  return err_code;
+}
+
+int s21_mult_matrix_file(const char *a_path, const char *b_path,
+                         const char *result_path, size_t budget) {
+  if (a_path == NULL || b_path == NULL || result_path == NULL) {
+    return INCORRECT_MATRIX;
+  }
+  s21_ooc_t ooc;
+  memset(&ooc, 0, sizeof(ooc));
+  ooc.fd[0] = open(a_path, O_RDONLY);
+  ooc.fd[1] = open(b_path, O_RDONLY);
+  int err_code = INCORRECT_MATRIX;
+  if (ooc.fd[0] >= 0 && ooc.fd[1] >= 0 &&
+      s21_read_header(ooc.fd[0], &ooc.header[0]) == OK &&
+      s21_read_header(ooc.fd[1], &ooc.header[1]) == OK) {
+    err_code = CALCULATION_ERROR;
+  }
+  ooc.fd[2] = -1;
+  int m = ooc.header[0].rows;
+  int k = ooc.header[0].columns;
+  int n = ooc.header[1].columns;
+  if (err_code == CALCULATION_ERROR && k == ooc.header[1].rows) {
+    ooc.tile = s21_ooc_tile(budget, m, k, n);
+    s21_file_header(m, n, &ooc.header[2]);
+    ooc.fd[2] = open(result_path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (ooc.tile > 0 && ooc.fd[2] >= 0 &&
+        ftruncate(ooc.fd[2], S21_FILE_HEADER + ooc.header[2].data_bytes) ==
+            0) {
+      err_code = OK;
+    }
+  }
+  for (int s = 0; s < 2 && err_code == OK; s++) {
+    if (s21_tile_alloc(&ooc.a[s], ooc.tile) != OK ||
+        s21_tile_alloc(&ooc.b[s], ooc.tile) != OK ||
+        s21_tile_alloc(&ooc.c[s], ooc.tile) != OK) {
+      err_code = CALCULATION_ERROR;
+    }
+  }
+  if (err_code == OK) {
+    ooc.tiles_m = (m + ooc.tile - 1) / ooc.tile;
+    ooc.tiles_n = (n + ooc.tile - 1) / ooc.tile;
+    ooc.tiles_k = (k + ooc.tile - 1) / ooc.tile;
+    err_code = s21_ooc_run(&ooc);
+  }
+  if (err_code == OK) {
+    err_code = s21_ooc_checksum(&ooc);
+  }
+  for (int s = 0; s < 2; s++) {
+    s21_tile_free(&ooc.a[s]);
+    s21_tile_free(&ooc.b[s]);
+    s21_tile_free(&ooc.c[s]);
+  }
+  for (int f = 0; f < 3; f++) {
+    if (ooc.fd[f] >= 0) close(ooc.fd[f]);
+  }
+  return err_code;
+}
@@ -0,0 +1,191 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <pthread.h>
+#include <unistd.h>
+
+#include "s21_internal.h"
+
+typedef struct s21_pool {
+  pthread_mutex_t lock;
+  pthread_cond_t wake;
+  pthread_cond_t done;
+  pthread_mutex_t busy;
+  pthread_t *workers;
+  int started;
+  int stop;
+  unsigned generation;
+  s21_task_fn fn;
+  void *ctx;
+  int tasks;
+  int next;
+  int finished;
+} s21_pool_t;
+
+static s21_pool_t s21_pool = {.lock = PTHREAD_MUTEX_INITIALIZER,
+                              .wake = PTHREAD_COND_INITIALIZER,
+                              .done = PTHREAD_COND_INITIALIZER,
+                              .busy = PTHREAD_MUTEX_INITIALIZER};
+static pthread_mutex_t s21_pool_config = PTHREAD_MUTEX_INITIALIZER;
+static int s21_thread_count = 0;
+static int s21_parallel_threshold = S21_PARALLEL_THRESHOLD;
+static _Thread_local int s21_in_worker = 0;
+static _Thread_local double *s21_buffer = NULL;
+static _Thread_local size_t s21_buffer_size = 0;
+static pthread_key_t s21_buffer_key;
+static pthread_once_t s21_buffer_once = PTHREAD_ONCE_INIT;
+
+static int s21_hardware_threads(void) {
+  long count = sysconf(_SC_NPROCESSORS_ONLN);
+  return count < 1 ? 1 : count > S21_MAX_THREADS ? S21_MAX_THREADS : count;
+}
+
+static void s21_buffer_key_init(void) {
+  pthread_key_create(&s21_buffer_key, free);
+}
+
+double *s21_thread_buffer(size_t count) {
+  if (count > s21_buffer_size) {
+    pthread_once(&s21_buffer_once, s21_buffer_key_init);
+    double *grown = s21_alloc_block(count);
+    if (grown != NULL) {
+      free(s21_buffer);
+      s21_buffer = grown;
+      s21_buffer_size = count;
+      pthread_setspecific(s21_buffer_key, grown);
+    }
+  }
+  return count <= s21_buffer_size ? s21_buffer : NULL;
+}
+
+void s21_release_thread_buffer(void) {
+  if (s21_buffer != NULL) pthread_setspecific(s21_buffer_key, NULL);
+  free(s21_buffer);
+  s21_buffer = NULL;
+  s21_buffer_size = 0;
+}
+
+static void s21_run_tasks(s21_pool_t *pool) {
+  while (pool->next < pool->tasks) {
+    int task = pool->next++;
+    s21_task_fn fn = pool->fn;
+    void *ctx = pool->ctx;
+    pthread_mutex_unlock(&pool->lock);
+    fn(ctx, task);
+    pthread_mutex_lock(&pool->lock);
+    if (++pool->finished == pool->tasks) pthread_cond_broadcast(&pool->done);
+  }
+}
+
+static void *s21_worker(void *arg) {
+  s21_pool_t *pool = (s21_pool_t *)arg;
+  s21_in_worker = 1;
+  pthread_mutex_lock(&pool->lock);
+  unsigned seen = pool->generation;
+  while (!pool->stop) {
+    if (pool->generation == seen) {
+      pthread_cond_wait(&pool->wake, &pool->lock);
+    } else {
+      seen = pool->generation;
+      s21_run_tasks(pool);
+    }
+  }
+  pthread_mutex_unlock(&pool->lock);
+  return NULL;
+}
+
+static void s21_pool_stop(s21_pool_t *pool) {
+  if (pool->started > 0) {
+    pthread_mutex_lock(&pool->lock);
+    pool->stop = 1;
+    pthread_cond_broadcast(&pool->wake);
+    pthread_mutex_unlock(&pool->lock);
+    for (int i = 0; i < pool->started; i++) {
+      pthread_join(pool->workers[i], NULL);
+    }
+  }
+  free(pool->workers);
+  pool->workers = NULL;
+  pool->started = 0;
+  pool->stop = 0;
+}
+
+static void s21_pool_start(s21_pool_t *pool, int count) {
+  pool->workers = (pthread_t *)malloc(count * sizeof(pthread_t));
+  for (int i = 0; pool->workers != NULL && i < count; i++) {
+    if (pthread_create(&pool->workers[i], NULL, s21_worker, pool) != 0) break;
+    pool->started++;
+  }
+}
+
+int s21_set_num_threads(int count) {
+  if (count < 1) count = s21_hardware_threads();
+  if (count > S21_MAX_THREADS) count = S21_MAX_THREADS;
+  pthread_mutex_lock(&s21_pool_config);
+  pthread_mutex_lock(&s21_pool.busy);
+  if (count != s21_thread_count) s21_pool_stop(&s21_pool);
+  s21_thread_count = count;
+  pthread_mutex_unlock(&s21_pool.busy);
+  pthread_mutex_unlock(&s21_pool_config);
+  return count;
+}
+
+int s21_get_num_threads(void) {
+  pthread_mutex_lock(&s21_pool_config);
+  if (s21_thread_count < 1) s21_thread_count = s21_hardware_threads();
+  int count = s21_thread_count;
+  pthread_mutex_unlock(&s21_pool_config);
+  return count;
+}
+
+void s21_set_parallel_threshold(int size) {
+  pthread_mutex_lock(&s21_pool_config);
+  s21_parallel_threshold = size < 1 ? S21_PARALLEL_THRESHOLD : size;
+  pthread_mutex_unlock(&s21_pool_config);
+}
+
+void s21_shutdown_threads(void) {
+  pthread_mutex_lock(&s21_pool_config);
+  pthread_mutex_lock(&s21_pool.busy);
+  s21_pool_stop(&s21_pool);
+  pthread_mutex_unlock(&s21_pool.busy);
+  pthread_mutex_unlock(&s21_pool_config);
+  s21_release_thread_buffer();
+}
+
+int s21_parallel_workers(double work) {
+  int workers = 1;
+  if (!s21_in_worker) {
+    pthread_mutex_lock(&s21_pool_config);
+    double cut = (double)s21_parallel_threshold * s21_parallel_threshold *
+                 s21_parallel_threshold;
+    pthread_mutex_unlock(&s21_pool_config);
+    if (work >= cut) workers = s21_get_num_threads();
+  }
+  return workers;
+}
+
+void s21_parallel_for(int tasks, s21_task_fn fn, void *ctx) {
+  int workers = s21_in_worker ? 1 : s21_get_num_threads();
+  if (tasks > 1 && workers > 1 && pthread_mutex_trylock(&s21_pool.busy) == 0) {
+    s21_pool_t *pool = &s21_pool;
+    if (pool->started == 0) s21_pool_start(pool, workers - 1);
+    pthread_mutex_lock(&pool->lock);
+    pool->fn = fn;
+    pool->ctx = ctx;
+    pool->tasks = tasks;
+    pool->next = 0;
+    pool->finished = 0;
+    pool->generation++;
+    pthread_cond_broadcast(&pool->wake);
+    s21_in_worker = 1;
+    s21_run_tasks(pool);
+    s21_in_worker = 0;
+    while (pool->finished < pool->tasks) {
+      pthread_cond_wait(&pool->done, &pool->lock);
+    }
+    pthread_mutex_unlock(&pool->lock);
+    pthread_mutex_unlock(&pool->busy);
+  } else {
+    for (int task = 0; task < tasks; task++) fn(ctx, task);
+  }
+}
@@ -0,0 +1,235 @@
+#include <float.h>
+#include <string.h>
+
+#include "s21_internal.h"
+
+typedef struct s21_qr_work {
+  matrix_t v;
+  matrix_t t;
+  matrix_t w;
+  matrix_t wt;
+} s21_qr_work_t;
+
+static size_t s21_qr_work_bytes(int m, int n, int nb) {
+  return s21_matrix_bytes(m, nb) + 2 * s21_matrix_bytes(nb, nb) +
+         2 * s21_matrix_bytes(nb, n);
+}
+
+static void s21_qr_work_open(int m, int n, int nb, arena_t *arena,
+                             s21_qr_work_t *work) {
+  s21_create_matrix_arena(m, nb, arena, &work->v);
+  s21_create_matrix_arena(nb, nb, arena, &work->t);
+  s21_create_matrix_arena(nb, n, arena, &work->w);
+  s21_create_matrix_arena(nb, n, arena, &work->wt);
+}
+
+static double s21_qr_norm(double **a, int m, int i0, int j) {
+  double scale = 0;
+  for (int i = i0; i < m; i++) {
+    if (fabs(a[i][j]) > scale) scale = fabs(a[i][j]);
+  }
+  double sum = 0;
+  for (int i = i0; i < m && scale > 0; i++) {
+    double x = a[i][j] / scale;
+    sum += x * x;
+  }
+  return scale * sqrt(sum);
+}
+
+static void s21_qr_leaf(double **a, int m, int k0, int k1, double *tau,
+                        double *w) {
+  for (int j = k0; j < k1; j++) {
+    double alpha = a[j][j];
+    double norm = s21_qr_norm(a, m, j + 1, j);
+    tau[j] = 0;
+    if (norm > 0) {
+      double beta = alpha < 0 ? hypot(alpha, norm) : -hypot(alpha, norm);
+      double scale = 1.0 / (alpha - beta);
+      tau[j] = (beta - alpha) / beta;
+      for (int i = j + 1; i < m; i++) a[i][j] *= scale;
+      a[j][j] = beta;
+    }
+    if (tau[j] != 0 && j + 1 < k1) {
+      int nc = k1 - j - 1;
+      memcpy(w, a[j] + j + 1, nc * sizeof(double));
+      for (int i = j + 1; i < m; i++) {
+        double v = a[i][j];
+        for (int c = 0; c < nc; c++) w[c] += v * a[i][j + 1 + c];
+      }
+      for (int c = 0; c < nc; c++) {
+        w[c] *= tau[j];
+        a[j][j + 1 + c] -= w[c];
+      }
+      for (int i = j + 1; i < m; i++) {
+        double v = a[i][j];
+        for (int c = 0; c < nc; c++) a[i][j + 1 + c] -= v * w[c];
+      }
+    }
+  }
+}
+
+static void s21_qr_block(double **a, int m, int k0, int kb, const double *tau,
+                         s21_qr_work_t *work) {
+  int mk = m - k0;
+  double **v = work->v.matrix;
+  double **t = work->t.matrix;
+  double **g = work->w.matrix;
+  for (int i = 0; i < mk; i++) {
+    for (int j = 0; j < kb; j++) {
+      v[i][j] = i > j ? a[k0 + i][k0 + j] : (i == j ? 1.0 : 0.0);
+    }
+  }
+  s21_dgemm(S21_TRANS, S21_NO_TRANS, kb, kb, mk, 1.0, v, 0, v, 0, 0.0, g, 0);
+  for (int j = 0; j < kb; j++) {
+    for (int i = 0; i < j; i++) {
+      double s = 0;
+      for (int l = i; l < j; l++) s += t[i][l] * g[l][j];
+      t[i][j] = -tau[k0 + j] * s;
+    }
+    t[j][j] = tau[k0 + j];
+    for (int i = j + 1; i < kb; i++) t[i][j] = 0;
+  }
+}
+
+static void s21_qr_apply(int trans, int mk, int kb, s21_qr_work_t *work,
+                         double **c, int jc, int nc) {
+  double **w = work->w.matrix;
+  double **wt = work->wt.matrix;
+  s21_dgemm(S21_TRANS, S21_NO_TRANS, kb, nc, mk, 1.0, work->v.matrix, 0, c, jc,
+            0.0, w, 0);
+  s21_dgemm(trans, S21_NO_TRANS, kb, nc, kb, 1.0, work->t.matrix, 0, w, 0, 0.0,
+            wt, 0);
+  s21_dgemm(S21_NO_TRANS, S21_NO_TRANS, mk, nc, kb, -1.0, work->v.matrix, 0,
+            wt, 0, 1.0, c, jc);
+}
+
+static void s21_qr_panel(double **a, int m, int k0, int k1, double *tau,
+                         s21_qr_work_t *work) {
+  if (k1 - k0 <= S21_QR_LEAF) {
+    s21_qr_leaf(a, m, k0, k1, tau, work->w.data);
+  } else {
+    int h = k0 + (k1 - k0) / 2;
+    s21_qr_panel(a, m, k0, h, tau, work);
+    s21_qr_block(a, m, k0, h - k0, tau, work);
+    s21_qr_apply(S21_TRANS, m - k0, h - k0, work, a + k0, h, k1 - h);
+    s21_qr_panel(a, m, h, k1, tau, work);
+  }
+}
+
+static void s21_qr_factor(double **a, int m, int n, double *tau,
+                          s21_qr_work_t *work) {
+  for (int k0 = 0; k0 < n; k0 += S21_QR_BLOCK) {
+    int k1 = n - k0 < S21_QR_BLOCK ? n : k0 + S21_QR_BLOCK;
+    s21_qr_panel(a, m, k0, k1, tau, work);
+    if (k1 < n) {
+      s21_qr_block(a, m, k0, k1 - k0, tau, work);
+      s21_qr_apply(S21_TRANS, m - k0, k1 - k0, work, a + k0, k1, n - k1);
+    }
+  }
+}
+
+static void s21_qr_form_q(double **a, int m, int n, const double *tau,
+                          s21_qr_work_t *work, matrix_t *Q) {
+  for (int i = 0; i < n; i++) Q->matrix[i][i] = 1.0;
+  int last = (n - 1) / S21_QR_BLOCK * S21_QR_BLOCK;
+  for (int k0 = last; k0 >= 0; k0 -= S21_QR_BLOCK) {
+    int kb = n - k0 < S21_QR_BLOCK ? n - k0 : S21_QR_BLOCK;
+    s21_qr_block(a, m, k0, kb, tau, work);
+    s21_qr_apply(S21_NO_TRANS, m - k0, kb, work, Q->matrix + k0, k0, n - k0);
+  }
+}
+
+static int s21_qr_open(matrix_t *A, int nc, s21_scratch_t *scratch,
+                       matrix_t *F, double **tau, s21_qr_work_t *work) {
+  int m = A->rows;
+  int n = A->columns;
+  int nb = n < S21_QR_BLOCK ? n : S21_QR_BLOCK;
+  int wide = nc > n ? nc : n;
+  size_t bytes = s21_matrix_bytes(m, n) + n * sizeof(double) + S21_ALIGNMENT +
+                 s21_qr_work_bytes(m, wide, nb);
+  int err_code = s21_scratch_open(scratch, bytes);
+  if (err_code == OK) {
+    s21_create_matrix_arena(m, n, scratch->arena, F);
+    s21_copy_logical(A, F);
+    *tau = (double *)s21_arena_alloc(scratch->arena, n * sizeof(double));
+    s21_qr_work_open(m, wide, nb, scratch->arena, work);
+    s21_qr_factor(F->matrix, m, n, *tau, work);
+  }
+  return err_code;
+}
+
+static int s21_qr_full_rank(matrix_t *F) {
+  int n = F->columns;
+  double max_diag = 0;
+  for (int i = 0; i < n; i++) {
+    if (fabs(F->matrix[i][i]) > max_diag) max_diag = fabs(F->matrix[i][i]);
+  }
+  double tol = (F->rows > n ? F->rows : n) * DBL_EPSILON * max_diag;
+  int full = max_diag > 0;
+  for (int i = 0; i < n && full; i++) full = fabs(F->matrix[i][i]) > tol;
+  return full;
+}
+
+int s21_qr(matrix_t *A, matrix_t *Q, matrix_t *R) {
+  if (!s21_is_matrix_ok(A) || Q == NULL || R == NULL) return INCORRECT_MATRIX;
+  int m = A->rows;
+  int n = A->columns;
+  int err_code = m >= n ? s21_create_matrix(m, n, Q) : CALCULATION_ERROR;
+  if (err_code == OK) {
+    err_code = s21_create_matrix(n, n, R);
+    if (err_code != OK) s21_remove_matrix(Q);
+  }
+  if (err_code == OK) {
+    s21_scratch_t scratch;
+    matrix_t F = {0};
+    double *tau = NULL;
+    s21_qr_work_t work;
+    err_code = s21_qr_open(A, 0, &scratch, &F, &tau, &work);
+    if (err_code == OK) {
+      for (int i = 0; i < n; i++) {
+        memcpy(R->matrix[i] + i, F.matrix[i] + i, (n - i) * sizeof(double));
+      }
+      s21_qr_form_q(F.matrix, m, n, tau, &work, Q);
+    }
+    s21_scratch_close(&scratch);
+    if (err_code != OK) {
+      s21_remove_matrix(Q);
+      s21_remove_matrix(R);
+    }
+  }
+  return err_code;
+}
+
+int s21_least_squares(matrix_t *A, matrix_t *B, matrix_t *result) {
+  if (!s21_is_matrix_ok(A) || !s21_is_matrix_ok(B)) return INCORRECT_MATRIX;
+  int m = A->rows;
+  int n = A->columns;
+  int nrhs = B->columns;
+  int err_code = CALCULATION_ERROR;
+  if (m >= n && B->rows == m) err_code = s21_create_matrix(n, nrhs, result);
+  if (err_code == OK) {
+    s21_scratch_t scratch;
+    matrix_t F = {0};
+    double *tau = NULL;
+    s21_qr_work_t work;
+    err_code = s21_qr_open(A, nrhs, &scratch, &F, &tau, &work);
+    if (err_code == OK && !s21_qr_full_rank(&F)) err_code = CALCULATION_ERROR;
+    matrix_t C = {0};
+    if (err_code == OK) err_code = s21_materialize(B, &C);
+    if (err_code == OK) {
+      for (int k0 = 0; k0 < n; k0 += S21_QR_BLOCK) {
+        int kb = n - k0 < S21_QR_BLOCK ? n - k0 : S21_QR_BLOCK;
+        s21_qr_block(F.matrix, m, k0, kb, tau, &work);
+        s21_qr_apply(S21_TRANS, m - k0, kb, &work, C.matrix + k0, 0, nrhs);
+      }
+      s21_trsm(S21_UPPER, S21_NO_TRANS, 0, n, F.matrix, 0, nrhs, C.matrix, 0);
+      for (int i = 0; i < n; i++) {
+        memcpy(result->matrix[i], C.matrix[i], nrhs * sizeof(double));
+      }
+      s21_remove_matrix(&C);
+    }
+    s21_scratch_close(&scratch);
+    if (err_code != OK) s21_remove_matrix(result);
+  }
+  return err_code;
+}
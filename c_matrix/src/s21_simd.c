@@ -0,0 +1,409 @@
+#include <string.h>
+
+#include "s21_internal.h"
+
+#ifdef S21_X86
+#include <immintrin.h>
+#endif
+
+static void s21_add_scalar(int n, const double *a, const double *b,
+                           double *out) {
+  for (int j = 0; j < n; j++) out[j] = a[j] + b[j];
+}
+
+static void s21_sub_scalar(int n, const double *a, const double *b,
+                           double *out) {
+  for (int j = 0; j < n; j++) out[j] = a[j] - b[j];
+}
+
+static void s21_scale_scalar(int n, const double *a, double k, double *out) {
+  for (int j = 0; j < n; j++) out[j] = a[j] * k;
+}
+
+static int s21_eq_scalar(int n, const double *a, const double *b,
+                         double tol) {
+  int equal = SUCCESS;
+  for (int j = 0; j < n && equal; j++) {
+    if (fabs(a[j] - b[j]) > tol) equal = FAILURE;
+  }
+  return equal;
+}
+
+static void s21_micro_scalar(int kc, const double *a, const double *b,
+                             double *ab) {
+  double acc[S21_GEMM_MR][S21_GEMM_NR] = {{0}};
+  for (int p = 0; p < kc; p++) {
+    const double *ap = a + p * S21_GEMM_MR;
+    const double *bp = b + p * S21_GEMM_NR;
+    for (int i = 0; i < S21_GEMM_MR; i++) {
+      for (int j = 0; j < S21_GEMM_NR; j++) acc[i][j] += ap[i] * bp[j];
+    }
+  }
+  memcpy(ab, acc, sizeof(acc));
+}
+
+static void s21_transpose_scalar(double *const *src, int js, double **dst,
+                                 int jd) {
+  for (int i = 0; i < 4; i++) {
+    for (int j = 0; j < 4; j++) dst[j][jd + i] = src[i][js + j];
+  }
+}
+
+#ifdef S21_X86
+static void s21_add_sse2(int n, const double *a, const double *b,
+                         double *out) {
+  int j = 0;
+  for (; j + 2 <= n; j += 2) {
+    _mm_storeu_pd(out + j,
+                  _mm_add_pd(_mm_loadu_pd(a + j), _mm_loadu_pd(b + j)));
+  }
+  for (; j < n; j++) out[j] = a[j] + b[j];
+}
+
+static void s21_sub_sse2(int n, const double *a, const double *b,
+                         double *out) {
+  int j = 0;
+  for (; j + 2 <= n; j += 2) {
+    _mm_storeu_pd(out + j,
+                  _mm_sub_pd(_mm_loadu_pd(a + j), _mm_loadu_pd(b + j)));
+  }
+  for (; j < n; j++) out[j] = a[j] - b[j];
+}
+
+static void s21_scale_sse2(int n, const double *a, double k, double *out) {
+  __m128d factor = _mm_set1_pd(k);
+  int j = 0;
+  for (; j + 2 <= n; j += 2) {
+    _mm_storeu_pd(out + j, _mm_mul_pd(_mm_loadu_pd(a + j), factor));
+  }
+  for (; j < n; j++) out[j] = a[j] * k;
+}
+
+static int s21_eq_sse2(int n, const double *a, const double *b, double tol) {
+  __m128d sign = _mm_set1_pd(-0.0);
+  __m128d limit = _mm_set1_pd(tol);
+  int differ = 0;
+  int j = 0;
+  for (; j + 2 <= n && !differ; j += 2) {
+    __m128d diff = _mm_sub_pd(_mm_loadu_pd(a + j), _mm_loadu_pd(b + j));
+    differ = _mm_movemask_pd(_mm_cmpgt_pd(_mm_andnot_pd(sign, diff), limit));
+  }
+  return differ ? FAILURE : s21_eq_scalar(n - j, a + j, b + j, tol);
+}
+
+static void s21_transpose_sse2(double *const *src, int js, double **dst,
+                               int jd) {
+  for (int i = 0; i < 4; i += 2) {
+    for (int j = 0; j < 4; j += 2) {
+      __m128d r0 = _mm_loadu_pd(src[i] + js + j);
+      __m128d r1 = _mm_loadu_pd(src[i + 1] + js + j);
+      _mm_storeu_pd(dst[j] + jd + i, _mm_unpacklo_pd(r0, r1));
+      _mm_storeu_pd(dst[j + 1] + jd + i, _mm_unpackhi_pd(r0, r1));
+    }
+  }
+}
+
+typedef double s21_vec2 __attribute__((vector_size(16)));
+
+static void s21_micro_sse2(int kc, const double *a, const double *b,
+                           double *ab) {
+  s21_vec2 c00 = {0}, c01 = {0}, c02 = {0}, c03 = {0};
+  s21_vec2 c10 = {0}, c11 = {0}, c12 = {0}, c13 = {0};
+  s21_vec2 c20 = {0}, c21 = {0}, c22 = {0}, c23 = {0};
+  s21_vec2 c30 = {0}, c31 = {0}, c32 = {0}, c33 = {0};
+  for (int p = 0; p < kc; p++) {
+    const s21_vec2 *bp = (const s21_vec2 *)(b + p * S21_GEMM_NR);
+    const double *ap = a + p * S21_GEMM_MR;
+    s21_vec2 b0 = bp[0], b1 = bp[1], b2 = bp[2], b3 = bp[3];
+    s21_vec2 a0 = {ap[0], ap[0]}, a1 = {ap[1], ap[1]};
+    c00 += a0 * b0;
+    c01 += a0 * b1;
+    c02 += a0 * b2;
+    c03 += a0 * b3;
+    c10 += a1 * b0;
+    c11 += a1 * b1;
+    c12 += a1 * b2;
+    c13 += a1 * b3;
+    s21_vec2 a2 = {ap[2], ap[2]}, a3 = {ap[3], ap[3]};
+    c20 += a2 * b0;
+    c21 += a2 * b1;
+    c22 += a2 * b2;
+    c23 += a2 * b3;
+    c30 += a3 * b0;
+    c31 += a3 * b1;
+    c32 += a3 * b2;
+    c33 += a3 * b3;
+  }
+  const s21_vec2 tile[] = {c00, c01, c02, c03, c10, c11, c12, c13,
+                           c20, c21, c22, c23, c30, c31, c32, c33};
+  memcpy(ab, tile, sizeof(tile));
+}
+
+S21_AVX2 static void s21_add_avx2(int n, const double *a, const double *b,
+                                  double *out) {
+  int j = 0;
+  for (; j + 4 <= n; j += 4) {
+    _mm256_storeu_pd(out + j, _mm256_add_pd(_mm256_loadu_pd(a + j),
+                                            _mm256_loadu_pd(b + j)));
+  }
+  for (; j < n; j++) out[j] = a[j] + b[j];
+}
+
+S21_AVX2 static void s21_sub_avx2(int n, const double *a, const double *b,
+                                  double *out) {
+  int j = 0;
+  for (; j + 4 <= n; j += 4) {
+    _mm256_storeu_pd(out + j, _mm256_sub_pd(_mm256_loadu_pd(a + j),
+                                            _mm256_loadu_pd(b + j)));
+  }
+  for (; j < n; j++) out[j] = a[j] - b[j];
+}
+
+S21_AVX2 static void s21_scale_avx2(int n, const double *a, double k,
+                                    double *out) {
+  __m256d factor = _mm256_set1_pd(k);
+  int j = 0;
+  for (; j + 4 <= n; j += 4) {
+    _mm256_storeu_pd(out + j, _mm256_mul_pd(_mm256_loadu_pd(a + j), factor));
+  }
+  for (; j < n; j++) out[j] = a[j] * k;
+}
+
+S21_AVX2 static int s21_eq_avx2(int n, const double *a, const double *b,
+                                double tol) {
+  __m256d sign = _mm256_set1_pd(-0.0);
+  __m256d limit = _mm256_set1_pd(tol);
+  int differ = 0;
+  int j = 0;
+  for (; j + 4 <= n && !differ; j += 4) {
+    __m256d diff =
+        _mm256_sub_pd(_mm256_loadu_pd(a + j), _mm256_loadu_pd(b + j));
+    __m256d gt =
+        _mm256_cmp_pd(_mm256_andnot_pd(sign, diff), limit, _CMP_GT_OQ);
+    differ = _mm256_movemask_pd(gt);
+  }
+  return differ ? FAILURE : s21_eq_scalar(n - j, a + j, b + j, tol);
+}
+
+S21_AVX2 static void s21_transpose_avx2(double *const *src, int js,
+                                        double **dst, int jd) {
+  __m256d r0 = _mm256_loadu_pd(src[0] + js);
+  __m256d r1 = _mm256_loadu_pd(src[1] + js);
+  __m256d r2 = _mm256_loadu_pd(src[2] + js);
+  __m256d r3 = _mm256_loadu_pd(src[3] + js);
+  __m256d t0 = _mm256_unpacklo_pd(r0, r1);
+  __m256d t1 = _mm256_unpackhi_pd(r0, r1);
+  __m256d t2 = _mm256_unpacklo_pd(r2, r3);
+  __m256d t3 = _mm256_unpackhi_pd(r2, r3);
+  _mm256_storeu_pd(dst[0] + jd, _mm256_permute2f128_pd(t0, t2, 0x20));
+  _mm256_storeu_pd(dst[1] + jd, _mm256_permute2f128_pd(t1, t3, 0x20));
+  _mm256_storeu_pd(dst[2] + jd, _mm256_permute2f128_pd(t0, t2, 0x31));
+  _mm256_storeu_pd(dst[3] + jd, _mm256_permute2f128_pd(t1, t3, 0x31));
+}
+
+S21_AVX2 static void s21_micro_avx2(int kc, const double *a, const double *b,
+                                    double *ab) {
+  __m256d c00 = _mm256_setzero_pd(), c01 = _mm256_setzero_pd();
+  __m256d c10 = _mm256_setzero_pd(), c11 = _mm256_setzero_pd();
+  __m256d c20 = _mm256_setzero_pd(), c21 = _mm256_setzero_pd();
+  __m256d c30 = _mm256_setzero_pd(), c31 = _mm256_setzero_pd();
+  for (int p = 0; p < kc; p++) {
+    const double *ap = a + p * S21_GEMM_MR;
+    __m256d b0 = _mm256_load_pd(b + p * S21_GEMM_NR);
+    __m256d b1 = _mm256_load_pd(b + p * S21_GEMM_NR + 4);
+    __m256d x = _mm256_broadcast_sd(ap);
+    c00 = _mm256_fmadd_pd(x, b0, c00);
+    c01 = _mm256_fmadd_pd(x, b1, c01);
+    x = _mm256_broadcast_sd(ap + 1);
+    c10 = _mm256_fmadd_pd(x, b0, c10);
+    c11 = _mm256_fmadd_pd(x, b1, c11);
+    x = _mm256_broadcast_sd(ap + 2);
+    c20 = _mm256_fmadd_pd(x, b0, c20);
+    c21 = _mm256_fmadd_pd(x, b1, c21);
+    x = _mm256_broadcast_sd(ap + 3);
+    c30 = _mm256_fmadd_pd(x, b0, c30);
+    c31 = _mm256_fmadd_pd(x, b1, c31);
+  }
+  _mm256_store_pd(ab, c00);
+  _mm256_store_pd(ab + 4, c01);
+  _mm256_store_pd(ab + 8, c10);
+  _mm256_store_pd(ab + 12, c11);
+  _mm256_store_pd(ab + 16, c20);
+  _mm256_store_pd(ab + 20, c21);
+  _mm256_store_pd(ab + 24, c30);
+  _mm256_store_pd(ab + 28, c31);
+}
+
+S21_AVX512 static void s21_add_avx512(int n, const double *a, const double *b,
+                                      double *out) {
+  int j = 0;
+  for (; j + 8 <= n; j += 8) {
+    _mm512_storeu_pd(out + j, _mm512_add_pd(_mm512_loadu_pd(a + j),
+                                            _mm512_loadu_pd(b + j)));
+  }
+  if (j < n) {
+    __mmask8 tail = (__mmask8)((1u << (n - j)) - 1);
+    __m512d x = _mm512_maskz_loadu_pd(tail, a + j);
+    __m512d y = _mm512_maskz_loadu_pd(tail, b + j);
+    _mm512_mask_storeu_pd(out + j, tail, _mm512_add_pd(x, y));
+  }
+}
+
+S21_AVX512 static void s21_sub_avx512(int n, const double *a, const double *b,
+                                      double *out) {
+  int j = 0;
+  for (; j + 8 <= n; j += 8) {
+    _mm512_storeu_pd(out + j, _mm512_sub_pd(_mm512_loadu_pd(a + j),
+                                            _mm512_loadu_pd(b + j)));
+  }
+  if (j < n) {
+    __mmask8 tail = (__mmask8)((1u << (n - j)) - 1);
+    __m512d x = _mm512_maskz_loadu_pd(tail, a + j);
+    __m512d y = _mm512_maskz_loadu_pd(tail, b + j);
+    _mm512_mask_storeu_pd(out + j, tail, _mm512_sub_pd(x, y));
+  }
+}
+
+S21_AVX512 static void s21_scale_avx512(int n, const double *a, double k,
+                                        double *out) {
+  __m512d factor = _mm512_set1_pd(k);
+  int j = 0;
+  for (; j + 8 <= n; j += 8) {
+    _mm512_storeu_pd(out + j, _mm512_mul_pd(_mm512_loadu_pd(a + j), factor));
+  }
+  if (j < n) {
+    __mmask8 tail = (__mmask8)((1u << (n - j)) - 1);
+    __m512d x = _mm512_maskz_loadu_pd(tail, a + j);
+    _mm512_mask_storeu_pd(out + j, tail, _mm512_mul_pd(x, factor));
+  }
+}
+
+S21_AVX512 static int s21_eq_avx512(int n, const double *a, const double *b,
+                                    double tol) {
+  __m512d limit = _mm512_set1_pd(tol);
+  __mmask8 differ = 0;
+  int j = 0;
+  for (; j + 8 <= n && !differ; j += 8) {
+    __m512d diff =
+        _mm512_sub_pd(_mm512_loadu_pd(a + j), _mm512_loadu_pd(b + j));
+    differ = _mm512_cmp_pd_mask(_mm512_abs_pd(diff), limit, _CMP_GT_OQ);
+  }
+  if (j < n && !differ) {
+    __mmask8 tail = (__mmask8)((1u << (n - j)) - 1);
+    __m512d diff = _mm512_sub_pd(_mm512_maskz_loadu_pd(tail, a + j),
+                                 _mm512_maskz_loadu_pd(tail, b + j));
+    differ =
+        _mm512_mask_cmp_pd_mask(tail, _mm512_abs_pd(diff), limit, _CMP_GT_OQ);
+  }
+  return differ ? FAILURE : SUCCESS;
+}
+
+S21_AVX512 static void s21_transpose_avx512(double *const *src, int js,
+                                            double **dst, int jd) {
+  const __m512i lo2 = _mm512_set_epi64(13, 12, 5, 4, 9, 8, 1, 0);
+  const __m512i hi2 = _mm512_set_epi64(15, 14, 7, 6, 11, 10, 3, 2);
+  const __m512i lo4 = _mm512_set_epi64(11, 10, 9, 8, 3, 2, 1, 0);
+  const __m512i hi4 = _mm512_set_epi64(15, 14, 13, 12, 7, 6, 5, 4);
+  __m512d t[8];
+  __m512d u[8];
+  for (int i = 0; i < 8; i += 2) {
+    __m512d r0 = _mm512_loadu_pd(src[i] + js);
+    __m512d r1 = _mm512_loadu_pd(src[i + 1] + js);
+    t[i] = _mm512_unpacklo_pd(r0, r1);
+    t[i + 1] = _mm512_unpackhi_pd(r0, r1);
+  }
+  for (int i = 0; i < 8; i += 4) {
+    u[i] = _mm512_permutex2var_pd(t[i], lo2, t[i + 2]);
+    u[i + 1] = _mm512_permutex2var_pd(t[i + 1], lo2, t[i + 3]);
+    u[i + 2] = _mm512_permutex2var_pd(t[i], hi2, t[i + 2]);
+    u[i + 3] = _mm512_permutex2var_pd(t[i + 1], hi2, t[i + 3]);
+  }
+  for (int j = 0; j < 4; j++) {
+    _mm512_storeu_pd(dst[j] + jd, _mm512_permutex2var_pd(u[j], lo4, u[j + 4]));
+    _mm512_storeu_pd(dst[j + 4] + jd,
+                     _mm512_permutex2var_pd(u[j], hi4, u[j + 4]));
+  }
+}
+
+S21_AVX512 static void s21_micro_avx512(int kc, const double *a,
+                                        const double *b, double *ab) {
+  __m512d c0 = _mm512_setzero_pd(), c1 = _mm512_setzero_pd();
+  __m512d c2 = _mm512_setzero_pd(), c3 = _mm512_setzero_pd();
+  __m512d d0 = _mm512_setzero_pd(), d1 = _mm512_setzero_pd();
+  __m512d d2 = _mm512_setzero_pd(), d3 = _mm512_setzero_pd();
+  int p = 0;
+  for (; p + 2 <= kc; p += 2) {
+    const double *ap = a + p * S21_GEMM_MR;
+    __m512d b0 = _mm512_load_pd(b + p * S21_GEMM_NR);
+    __m512d b1 = _mm512_load_pd(b + (p + 1) * S21_GEMM_NR);
+    c0 = _mm512_fmadd_pd(_mm512_set1_pd(ap[0]), b0, c0);
+    c1 = _mm512_fmadd_pd(_mm512_set1_pd(ap[1]), b0, c1);
+    c2 = _mm512_fmadd_pd(_mm512_set1_pd(ap[2]), b0, c2);
+    c3 = _mm512_fmadd_pd(_mm512_set1_pd(ap[3]), b0, c3);
+    d0 = _mm512_fmadd_pd(_mm512_set1_pd(ap[4]), b1, d0);
+    d1 = _mm512_fmadd_pd(_mm512_set1_pd(ap[5]), b1, d1);
+    d2 = _mm512_fmadd_pd(_mm512_set1_pd(ap[6]), b1, d2);
+    d3 = _mm512_fmadd_pd(_mm512_set1_pd(ap[7]), b1, d3);
+  }
+  if (p < kc) {
+    const double *ap = a + p * S21_GEMM_MR;
+    __m512d b0 = _mm512_load_pd(b + p * S21_GEMM_NR);
+    c0 = _mm512_fmadd_pd(_mm512_set1_pd(ap[0]), b0, c0);
+    c1 = _mm512_fmadd_pd(_mm512_set1_pd(ap[1]), b0, c1);
+    c2 = _mm512_fmadd_pd(_mm512_set1_pd(ap[2]), b0, c2);
+    c3 = _mm512_fmadd_pd(_mm512_set1_pd(ap[3]), b0, c3);
+  }
+  _mm512_store_pd(ab, _mm512_add_pd(c0, d0));
+  _mm512_store_pd(ab + 8, _mm512_add_pd(c1, d1));
+  _mm512_store_pd(ab + 16, _mm512_add_pd(c2, d2));
+  _mm512_store_pd(ab + 24, _mm512_add_pd(c3, d3));
+}
+#endif
+
+static const s21_kernels_t s21_kernel_table[] = {
+    {s21_add_scalar, s21_sub_scalar, s21_scale_scalar, s21_eq_scalar,
+     s21_micro_scalar, s21_transpose_scalar, 4},
+#ifdef S21_X86
+    {s21_add_sse2, s21_sub_sse2, s21_scale_sse2, s21_eq_sse2, s21_micro_sse2,
+     s21_transpose_sse2, 4},
+    {s21_add_avx2, s21_sub_avx2, s21_scale_avx2, s21_eq_avx2, s21_micro_avx2,
+     s21_transpose_avx2, 4},
+    {s21_add_avx512, s21_sub_avx512, s21_scale_avx512, s21_eq_avx512,
+     s21_micro_avx512, s21_transpose_avx512, 8},
+#endif
+};
+
+static int s21_detected_level = -1;
+static int s21_active_level = -1;
+
+static int s21_detect_simd(void) {
+  int level = S21_SIMD_NONE;
+#ifdef S21_X86
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("sse2")) level = S21_SIMD_SSE2;
+  if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+    level = S21_SIMD_AVX2;
+  }
+  if (__builtin_cpu_supports("avx512f")) level = S21_SIMD_AVX512;
+#endif
+  return level;
+}
+
+int s21_simd_level(void) {
+  if (s21_detected_level < 0) s21_detected_level = s21_detect_simd();
+  if (s21_active_level < 0) s21_active_level = s21_detected_level;
+  return s21_active_level;
+}
+
+int s21_set_simd_level(int level) {
+  s21_simd_level();
+  if (level < S21_SIMD_NONE || level > s21_detected_level) {
+    level = s21_detected_level;
+  }
+  s21_active_level = level;
+  return s21_active_level;
+}
+
+const s21_kernels_t *s21_kernels(void) {
+  return &s21_kernel_table[s21_simd_level()];
+}
@@ -0,0 +1,111 @@
+#include "s21_internal.h"
+
+static double s21_adjugate_2(double **m, double *adj) {
+  adj[0] = m[1][1];
+  adj[1] = -m[0][1];
+  adj[2] = -m[1][0];
+  adj[3] = m[0][0];
+  return m[0][0] * m[1][1] - m[1][0] * m[0][1];
+}
+
+static double s21_adjugate_3(double **m, double *adj) {
+  adj[0] = m[1][1] * m[2][2] - m[2][1] * m[1][2];
+  adj[3] = m[2][0] * m[1][2] - m[1][0] * m[2][2];
+  adj[6] = m[1][0] * m[2][1] - m[2][0] * m[1][1];
+  adj[1] = m[2][1] * m[0][2] - m[0][1] * m[2][2];
+  adj[4] = m[0][0] * m[2][2] - m[2][0] * m[0][2];
+  adj[7] = m[2][0] * m[0][1] - m[0][0] * m[2][1];
+  adj[2] = m[0][1] * m[1][2] - m[1][1] * m[0][2];
+  adj[5] = m[1][0] * m[0][2] - m[0][0] * m[1][2];
+  adj[8] = m[0][0] * m[1][1] - m[1][0] * m[0][1];
+  return m[0][0] * adj[0] + m[0][1] * adj[3] + m[0][2] * adj[6];
+}
+
+static double s21_adjugate_4(double **m, double *adj) {
+  double s0 = m[0][0] * m[1][1] - m[1][0] * m[0][1];
+  double s1 = m[0][0] * m[1][2] - m[1][0] * m[0][2];
+  double s2 = m[0][0] * m[1][3] - m[1][0] * m[0][3];
+  double s3 = m[0][1] * m[1][2] - m[1][1] * m[0][2];
+  double s4 = m[0][1] * m[1][3] - m[1][1] * m[0][3];
+  double s5 = m[0][2] * m[1][3] - m[1][2] * m[0][3];
+  double c5 = m[2][2] * m[3][3] - m[3][2] * m[2][3];
+  double c4 = m[2][1] * m[3][3] - m[3][1] * m[2][3];
+  double c3 = m[2][1] * m[3][2] - m[3][1] * m[2][2];
+  double c2 = m[2][0] * m[3][3] - m[3][0] * m[2][3];
+  double c1 = m[2][0] * m[3][2] - m[3][0] * m[2][2];
+  double c0 = m[2][0] * m[3][1] - m[3][0] * m[2][1];
+  adj[0] = m[1][1] * c5 - m[1][2] * c4 + m[1][3] * c3;
+  adj[1] = -m[0][1] * c5 + m[0][2] * c4 - m[0][3] * c3;
+  adj[2] = m[3][1] * s5 - m[3][2] * s4 + m[3][3] * s3;
+  adj[3] = -m[2][1] * s5 + m[2][2] * s4 - m[2][3] * s3;
+  adj[4] = -m[1][0] * c5 + m[1][2] * c2 - m[1][3] * c1;
+  adj[5] = m[0][0] * c5 - m[0][2] * c2 + m[0][3] * c1;
+  adj[6] = -m[3][0] * s5 + m[3][2] * s2 - m[3][3] * s1;
+  adj[7] = m[2][0] * s5 - m[2][2] * s2 + m[2][3] * s1;
+  adj[8] = m[1][0] * c4 - m[1][1] * c2 + m[1][3] * c0;
+  adj[9] = -m[0][0] * c4 + m[0][1] * c2 - m[0][3] * c0;
+  adj[10] = m[3][0] * s4 - m[3][1] * s2 + m[3][3] * s0;
+  adj[11] = -m[2][0] * s4 + m[2][1] * s2 - m[2][3] * s0;
+  adj[12] = -m[1][0] * c3 + m[1][1] * c1 - m[1][2] * c0;
+  adj[13] = m[0][0] * c3 - m[0][1] * c1 + m[0][2] * c0;
+  adj[14] = -m[3][0] * s3 + m[3][1] * s1 - m[3][2] * s0;
+  adj[15] = m[2][0] * s3 - m[2][1] * s1 + m[2][2] * s0;
+  return s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+}
+
+static double s21_adjugate_small(matrix_t *A, double *adj) {
+  double det = 0;
+  if (A->rows == 1) {
+    adj[0] = 1.0;
+    det = A->matrix[0][0];
+  } else if (A->rows == 2) {
+    det = s21_adjugate_2(A->matrix, adj);
+  } else if (A->rows == 3) {
+    det = s21_adjugate_3(A->matrix, adj);
+  } else {
+    det = s21_adjugate_4(A->matrix, adj);
+  }
+  return det;
+}
+
+double s21_det_small(matrix_t *A) {
+  double **m = A->matrix;
+  double result = 0;
+  if (A->rows == 1) {
+    result = m[0][0];
+  } else if (A->rows == 2) {
+    result = m[0][0] * m[1][1] - m[1][0] * m[0][1];
+  } else if (A->rows == 3) {
+    result = m[0][0] * (m[1][1] * m[2][2] - m[2][1] * m[1][2]) -
+             m[0][1] * (m[1][0] * m[2][2] - m[2][0] * m[1][2]) +
+             m[0][2] * (m[1][0] * m[2][1] - m[2][0] * m[1][1]);
+  } else {
+    double adj[16];
+    result = s21_adjugate_4(m, adj);
+  }
+  return result;
+}
+
+int s21_small_inverse(matrix_t *A, matrix_t *result) {
+  int n = A->rows;
+  double adj[16];
+  double det = s21_adjugate_small(A, adj);
+  int err_code = CALCULATION_ERROR;
+  if (det != 0) {
+    double inv = 1.0 / det;
+    for (int i = 0; i < n; i++) {
+      for (int j = 0; j < n; j++) result->matrix[i][j] = adj[i * n + j] * inv;
+    }
+    err_code = OK;
+  }
+  return err_code;
+}
+
+void s21_small_complements(matrix_t *A, matrix_t *result) {
+  int n = A->rows;
+  double adj[16];
+  s21_adjugate_small(A, adj);
+  for (int i = 0; i < n; i++) {
+    for (int j = 0; j < n; j++) result->matrix[i][j] = adj[j * n + i];
+  }
+}
@@ -0,0 +1,342 @@
+#include <limits.h>
+#include <string.h>
+
+#include "s21_internal.h"
+
+typedef struct s21_spmm_job {
+  sparse_t *A;
+  matrix_t *B;
+  matrix_t *C;
+  int rows_per_task;
+} s21_spmm_job_t;
+
+static int s21_is_sparse_ok(sparse_t *A) {
+  return A != NULL && A->offsets != NULL && A->rows > 0 && A->columns > 0 &&
+         A->nnz >= 0 && (A->format == S21_CSR || A->format == S21_CSC) &&
+         (A->nnz == 0 || (A->values != NULL && A->indices != NULL));
+}
+
+static int s21_major(sparse_t *A) {
+  return A->format == S21_CSR ? A->rows : A->columns;
+}
+
+static int s21_minor(sparse_t *A) {
+  return A->format == S21_CSR ? A->columns : A->rows;
+}
+
+int s21_create_sparse(int rows, int columns, int nnz, int format,
+                      sparse_t *result) {
+  int err_code = INCORRECT_MATRIX;
+  if (result != NULL) {
+    memset(result, 0, sizeof(*result));
+    if (rows > 0 && columns > 0 && nnz >= 0 && rows < INT_MAX &&
+        columns < INT_MAX && (format == S21_CSR || format == S21_CSC)) {
+      int major = format == S21_CSR ? rows : columns;
+      size_t capacity = nnz > 0 ? (size_t)nnz : 1;
+      result->offsets = (int *)calloc((size_t)major + 1, sizeof(int));
+      result->indices = (int *)malloc(capacity * sizeof(int));
+      result->values = (double *)malloc(capacity * sizeof(double));
+      if (result->offsets && result->indices && result->values) {
+        result->rows = rows;
+        result->columns = columns;
+        result->nnz = nnz;
+        result->format = format;
+        err_code = OK;
+      } else {
+        s21_remove_sparse(result);
+        err_code = INCORRECT_MATRIX;
+      }
+    }
+  }
+  return err_code;
+}
+
+void s21_remove_sparse(sparse_t *A) {
+  if (A != NULL) {
+    free(A->values);
+    free(A->indices);
+    free(A->offsets);
+    memset(A, 0, sizeof(*A));
+  }
+}
+
+int s21_sparse_from_triplets(int rows, int columns, int count,
+                             const int *row_idx, const int *col_idx,
+                             const double *values, int format,
+                             sparse_t *result) {
+  if (count < 0 || (count > 0 && (!row_idx || !col_idx || !values))) {
+    return INCORRECT_MATRIX;
+  }
+  int err_code = s21_create_sparse(rows, columns, count, format, result);
+  for (int p = 0; p < count && err_code == OK; p++) {
+    if (row_idx[p] < 0 || row_idx[p] >= rows || col_idx[p] < 0 ||
+        col_idx[p] >= columns) {
+      err_code = CALCULATION_ERROR;
+    }
+  }
+  const int *major_idx = format == S21_CSR ? row_idx : col_idx;
+  const int *minor_idx = format == S21_CSR ? col_idx : row_idx;
+  int minor = format == S21_CSR ? columns : rows;
+  int major = format == S21_CSR ? rows : columns;
+  int *order = NULL;
+  int *start = NULL;
+  if (err_code == OK) {
+    order = (int *)malloc((count > 0 ? (size_t)count : 1) * sizeof(int));
+    start = (int *)calloc((size_t)(major > minor ? major : minor) + 1,
+                          sizeof(int));
+    if (!order || !start) err_code = INCORRECT_MATRIX;
+  }
+  if (err_code == OK) {
+    for (int p = 0; p < count; p++) start[minor_idx[p] + 1]++;
+    for (int j = 0; j < minor; j++) start[j + 1] += start[j];
+    for (int p = 0; p < count; p++) order[start[minor_idx[p]]++] = p;
+    int *offsets = result->offsets;
+    for (int p = 0; p < count; p++) offsets[major_idx[p] + 1]++;
+    for (int i = 0; i < major; i++) offsets[i + 1] += offsets[i];
+    int *next = start;
+    memcpy(next, offsets, (size_t)major * sizeof(int));
+    int *slot = result->indices;
+    double *staged = result->values;
+    for (int q = 0; q < count; q++) {
+      int p = order[q];
+      int at = next[major_idx[p]]++;
+      slot[at] = minor_idx[p];
+      staged[at] = values[p];
+    }
+    int nnz = 0;
+    for (int i = 0; i < major; i++) {
+      int begin = offsets[i];
+      offsets[i] = nnz;
+      for (int p = begin; p < offsets[i + 1]; p++) {
+        if (nnz > offsets[i] && slot[nnz - 1] == slot[p]) {
+          staged[nnz - 1] += staged[p];
+        } else {
+          slot[nnz] = slot[p];
+          staged[nnz++] = staged[p];
+        }
+      }
+    }
+    offsets[major] = nnz;
+    result->nnz = nnz;
+  } else if (result != NULL && result->offsets != NULL) {
+    s21_remove_sparse(result);
+  }
+  free(order);
+  free(start);
+  return err_code;
+}
+
+int s21_dense_to_sparse(matrix_t *A, int format, sparse_t *result) {
+  if (!s21_is_matrix_ok(A)) return INCORRECT_MATRIX;
+  int nnz = 0;
+  for (int i = 0; i < A->rows; i++) {
+    for (int j = 0; j < A->columns; j++) {
+      if (*s21_at(A, i, j) != 0) nnz++;
+    }
+  }
+  int err_code = s21_create_sparse(A->rows, A->columns, nnz, format, result);
+  if (err_code == OK) {
+    int major = s21_major(result);
+    int minor = s21_minor(result);
+    int count = 0;
+    for (int a = 0; a < major; a++) {
+      for (int b = 0; b < minor; b++) {
+        double value = format == S21_CSR ? *s21_at(A, a, b) : *s21_at(A, b, a);
+        if (value != 0) {
+          result->indices[count] = b;
+          result->values[count++] = value;
+        }
+      }
+      result->offsets[a + 1] = count;
+    }
+  }
+  return err_code;
+}
+
+int s21_sparse_to_dense(sparse_t *A, matrix_t *result) {
+  if (!s21_is_sparse_ok(A)) return INCORRECT_MATRIX;
+  int err_code = s21_create_matrix(A->rows, A->columns, result);
+  if (err_code == OK) {
+    for (int a = 0; a < s21_major(A); a++) {
+      for (int p = A->offsets[a]; p < A->offsets[a + 1]; p++) {
+        if (A->format == S21_CSR) {
+          result->matrix[a][A->indices[p]] = A->values[p];
+        } else {
+          result->matrix[A->indices[p]][a] = A->values[p];
+        }
+      }
+    }
+  }
+  return err_code;
+}
+
+int s21_sparse_convert(sparse_t *A, int format, sparse_t *result) {
+  if (!s21_is_sparse_ok(A)) return INCORRECT_MATRIX;
+  int err_code =
+      s21_create_sparse(A->rows, A->columns, A->nnz, format, result);
+  if (err_code == OK && format == A->format) {
+    memcpy(result->offsets, A->offsets,
+           ((size_t)s21_major(A) + 1) * sizeof(int));
+    memcpy(result->indices, A->indices, (size_t)A->nnz * sizeof(int));
+    memcpy(result->values, A->values, (size_t)A->nnz * sizeof(double));
+  } else if (err_code == OK) {
+    int major = s21_major(A);
+    int minor = s21_minor(A);
+    int *offsets = result->offsets;
+    for (int p = 0; p < A->nnz; p++) offsets[A->indices[p] + 1]++;
+    for (int j = 0; j < minor; j++) offsets[j + 1] += offsets[j];
+    for (int a = 0; a < major; a++) {
+      for (int p = A->offsets[a]; p < A->offsets[a + 1]; p++) {
+        int at = offsets[A->indices[p]]++;
+        result->indices[at] = a;
+        result->values[at] = A->values[p];
+      }
+    }
+    for (int j = minor; j > 0; j--) offsets[j] = offsets[j - 1];
+    offsets[0] = 0;
+  }
+  return err_code;
+}
+
+int s21_sparse_transpose(sparse_t *A, sparse_t *result) {
+  if (!s21_is_sparse_ok(A)) return INCORRECT_MATRIX;
+  int format = A->format == S21_CSR ? S21_CSC : S21_CSR;
+  int err_code = s21_sparse_convert(A, format, result);
+  if (err_code == OK) {
+    result->rows = A->columns;
+    result->columns = A->rows;
+    result->format = A->format;
+  }
+  return err_code;
+}
+
+int s21_sparse_mult_vector(sparse_t *A, const double *x, double *result) {
+  if (!s21_is_sparse_ok(A) || x == NULL || result == NULL) {
+    return INCORRECT_MATRIX;
+  }
+  if (A->format == S21_CSR) {
+    for (int i = 0; i < A->rows; i++) {
+      double sum = 0;
+      for (int p = A->offsets[i]; p < A->offsets[i + 1]; p++) {
+        sum += A->values[p] * x[A->indices[p]];
+      }
+      result[i] = sum;
+    }
+  } else {
+    memset(result, 0, (size_t)A->rows * sizeof(double));
+    for (int j = 0; j < A->columns; j++) {
+      double xj = x[j];
+      for (int p = A->offsets[j]; p < A->offsets[j + 1]; p++) {
+        result[A->indices[p]] += A->values[p] * xj;
+      }
+    }
+  }
+  return OK;
+}
+
+static void s21_axpy_row(int n, double alpha, const double *x, double *y) {
+  for (int j = 0; j < n; j++) y[j] += alpha * x[j];
+}
+
+static void s21_spmm_task(void *ctx, int task) {
+  s21_spmm_job_t *job = (s21_spmm_job_t *)ctx;
+  sparse_t *A = job->A;
+  int lo = task * job->rows_per_task;
+  int hi = lo + job->rows_per_task < A->rows ? lo + job->rows_per_task
+                                             : A->rows;
+  for (int i = lo; i < hi; i++) {
+    double *c = job->C->matrix[i];
+    for (int p = A->offsets[i]; p < A->offsets[i + 1]; p++) {
+      s21_axpy_row(job->B->columns, A->values[p],
+                   job->B->matrix[A->indices[p]], c);
+    }
+  }
+}
+
+static int s21_sparse_mult_lazy(sparse_t *A, matrix_t *B, matrix_t *result) {
+  s21_scratch_t scratch;
+  int err_code = s21_scratch_open(&scratch, s21_orient_bytes(B, 0));
+  if (err_code == OK) {
+    matrix_t b;
+    s21_orient(B, 0, scratch.arena, &b);
+    err_code = s21_sparse_mult_dense(A, &b, result);
+  }
+  s21_scratch_close(&scratch);
+  return err_code;
+}
+
+int s21_sparse_mult_dense(sparse_t *A, matrix_t *B, matrix_t *result) {
+  if (!s21_is_sparse_ok(A) || !s21_is_matrix_ok(B)) return INCORRECT_MATRIX;
+  if (A->columns != B->rows) return CALCULATION_ERROR;
+  if (s21_is_lazy(B)) return s21_sparse_mult_lazy(A, B, result);
+  int err_code = s21_create_matrix(A->rows, B->columns, result);
+  if (err_code == OK && A->format == S21_CSR) {
+    int workers = s21_parallel_workers((double)A->nnz * B->columns * 64.0);
+    s21_spmm_job_t job = {A, B, result, A->rows};
+    if (workers > 1) {
+      job.rows_per_task = (A->rows + 4 * workers - 1) / (4 * workers);
+    }
+    int tasks = (A->rows + job.rows_per_task - 1) / job.rows_per_task;
+    s21_parallel_for(tasks, s21_spmm_task, &job);
+  } else if (err_code == OK) {
+    for (int j = 0; j < A->columns; j++) {
+      for (int p = A->offsets[j]; p < A->offsets[j + 1]; p++) {
+        s21_axpy_row(B->columns, A->values[p], B->matrix[j],
+                     result->matrix[A->indices[p]]);
+      }
+    }
+  }
+  return err_code;
+}
+
+static int s21_sparse_merge(sparse_t *A, sparse_t *B, sparse_t *result,
+                            int fill) {
+  int nnz = 0;
+  for (int a = 0; a < s21_major(A); a++) {
+    int p = A->offsets[a], p_end = A->offsets[a + 1];
+    int q = B->offsets[a], q_end = B->offsets[a + 1];
+    while (p < p_end || q < q_end) {
+      int index = 0;
+      double value = 0;
+      if (q == q_end || (p < p_end && A->indices[p] < B->indices[q])) {
+        index = A->indices[p];
+        value = A->values[p++];
+      } else if (p == p_end || B->indices[q] < A->indices[p]) {
+        index = B->indices[q];
+        value = B->values[q++];
+      } else {
+        index = A->indices[p];
+        value = A->values[p++] + B->values[q++];
+      }
+      if (value != 0) {
+        if (fill) {
+          result->indices[nnz] = index;
+          result->values[nnz] = value;
+        }
+        nnz++;
+      }
+    }
+    if (fill) result->offsets[a + 1] = nnz;
+  }
+  return nnz;
+}
+
+int s21_sparse_sum(sparse_t *A, sparse_t *B, sparse_t *result) {
+  if (!s21_is_sparse_ok(A) || !s21_is_sparse_ok(B)) return INCORRECT_MATRIX;
+  if (A->rows != B->rows || A->columns != B->columns) {
+    return CALCULATION_ERROR;
+  }
+  sparse_t converted = {0};
+  int err_code = OK;
+  if (B->format != A->format) {
+    err_code = s21_sparse_convert(B, A->format, &converted);
+    B = &converted;
+  }
+  if (err_code == OK) {
+    int nnz = s21_sparse_merge(A, B, result, 0);
+    err_code = s21_create_sparse(A->rows, A->columns, nnz, A->format, result);
+    if (err_code == OK) s21_sparse_merge(A, B, result, 1);
+  }
+  s21_remove_sparse(&converted);
+  return err_code;
+}
@@ -0,0 +1,174 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <limits.h>
+#include <pthread.h>
+#include <string.h>
+
+#include "s21_internal.h"
+
+static pthread_mutex_t s21_strassen_config = PTHREAD_MUTEX_INITIALIZER;
+static int s21_strassen_crossover = 0;
+static int s21_strassen_depth = INT_MAX;
+
+int s21_set_strassen_crossover(int size) {
+  pthread_mutex_lock(&s21_strassen_config);
+  s21_strassen_crossover = size < 1 ? 0 : size;
+  pthread_mutex_unlock(&s21_strassen_config);
+  return size < 1 ? 0 : size;
+}
+
+int s21_set_strassen_depth(int levels) {
+  pthread_mutex_lock(&s21_strassen_config);
+  s21_strassen_depth = levels < 1 ? INT_MAX : levels;
+  pthread_mutex_unlock(&s21_strassen_config);
+  return levels < 1 ? INT_MAX : levels;
+}
+
+int s21_strassen_levels(int m, int k, int n) {
+  pthread_mutex_lock(&s21_strassen_config);
+  int crossover = s21_strassen_crossover;
+  int depth = s21_strassen_depth;
+  pthread_mutex_unlock(&s21_strassen_config);
+  int levels = 0;
+  while (crossover > 0 && levels < depth && m >= crossover &&
+         k >= crossover && n >= crossover) {
+    m = (m + 1) / 2;
+    k = (k + 1) / 2;
+    n = (n + 1) / 2;
+    levels++;
+  }
+  return levels;
+}
+
+static int s21_padded(int size, int levels) {
+  int block = 1 << levels;
+  return (size + block - 1) / block * block;
+}
+
+static size_t s21_winograd_bytes(int m, int k, int n, int levels) {
+  size_t bytes = 0;
+  for (; levels > 0; levels--) {
+    m /= 2;
+    k /= 2;
+    n /= 2;
+    bytes += s21_matrix_bytes(m, k > n ? k : n) + s21_matrix_bytes(k, n);
+  }
+  return bytes;
+}
+
+size_t s21_strassen_workspace(int rows, int inner, int columns, int levels) {
+  size_t bytes = 0;
+  if (rows > 0 && inner > 0 && columns > 0 && levels > 0 && levels < 30) {
+    int m = s21_padded(rows, levels);
+    int k = s21_padded(inner, levels);
+    int n = s21_padded(columns, levels);
+    if (m != rows || k != inner || n != columns) {
+      bytes += s21_matrix_bytes(m, k) + s21_matrix_bytes(k, n) +
+               s21_matrix_bytes(m, n);
+    }
+    bytes += s21_winograd_bytes(m, k, n, levels);
+  }
+  return bytes;
+}
+
+static void s21_quad_add(int rows, int columns, double *const *a, int ja,
+                         double *const *b, int jb, double **c, int jc) {
+  const s21_kernels_t *kernels = s21_kernels();
+  for (int i = 0; i < rows; i++) {
+    kernels->add(columns, a[i] + ja, b[i] + jb, c[i] + jc);
+  }
+}
+
+static void s21_quad_sub(int rows, int columns, double *const *a, int ja,
+                         double *const *b, int jb, double **c, int jc) {
+  const s21_kernels_t *kernels = s21_kernels();
+  for (int i = 0; i < rows; i++) {
+    kernels->sub(columns, a[i] + ja, b[i] + jb, c[i] + jc);
+  }
+}
+
+static void s21_winograd(int m, int k, int n, double alpha, double *const *a,
+                         int ja, double *const *b, int jb, double **c, int jc,
+                         int levels, arena_t *arena) {
+  if (levels == 0) {
+    s21_dgemm(S21_NO_TRANS, S21_NO_TRANS, m, n, k, alpha, a, ja, b, jb, 0.0,
+              c, jc);
+    return;
+  }
+  int m2 = m / 2, k2 = k / 2, n2 = n / 2;
+  size_t mark = s21_arena_mark(arena);
+  matrix_t X = {0};
+  matrix_t Y = {0};
+  s21_create_matrix_arena(m2, k2 > n2 ? k2 : n2, arena, &X);
+  s21_create_matrix_arena(k2, n2, arena, &Y);
+  double **x = X.matrix, **y = Y.matrix;
+  double *const *a2 = a + m2;
+  double *const *b2 = b + k2;
+  double **c2 = c + m2;
+  int ja2 = ja + k2, jb2 = jb + n2, jc2 = jc + n2;
+  int next = levels - 1;
+
+  s21_quad_sub(m2, k2, a, ja, a2, ja, x, 0);
+  s21_quad_sub(k2, n2, b2, jb2, b, jb2, y, 0);
+  s21_winograd(m2, k2, n2, alpha, x, 0, y, 0, c2, jc, next, arena);
+  s21_quad_add(m2, k2, a2, ja, a2, ja2, x, 0);
+  s21_quad_sub(k2, n2, b, jb2, b, jb, y, 0);
+  s21_winograd(m2, k2, n2, alpha, x, 0, y, 0, c2, jc2, next, arena);
+  s21_quad_sub(m2, k2, x, 0, a, ja, x, 0);
+  s21_quad_sub(k2, n2, b2, jb2, y, 0, y, 0);
+  s21_winograd(m2, k2, n2, alpha, x, 0, y, 0, c, jc2, next, arena);
+  s21_quad_sub(m2, k2, a, ja2, x, 0, x, 0);
+  s21_winograd(m2, k2, n2, alpha, x, 0, b2, jb2, c, jc, next, arena);
+  s21_winograd(m2, k2, n2, alpha, a, ja, b, jb, x, 0, next, arena);
+  s21_quad_add(m2, n2, x, 0, c, jc2, c, jc2);
+  s21_quad_add(m2, n2, c, jc2, c2, jc, c2, jc);
+  s21_quad_add(m2, n2, c, jc2, c2, jc2, c, jc2);
+  s21_quad_add(m2, n2, c2, jc, c2, jc2, c2, jc2);
+  s21_quad_add(m2, n2, c, jc2, c, jc, c, jc2);
+  s21_quad_sub(k2, n2, y, 0, b2, jb, y, 0);
+  s21_winograd(m2, k2, n2, alpha, a2, ja2, y, 0, c, jc, next, arena);
+  s21_quad_sub(m2, n2, c2, jc, c, jc, c2, jc);
+  s21_winograd(m2, k2, n2, alpha, a, ja2, b2, jb, c, jc, next, arena);
+  s21_quad_add(m2, n2, x, 0, c, jc, c, jc);
+  s21_arena_release(arena, mark);
+}
+
+static void s21_pad_copy(matrix_t *A, matrix_t *result) {
+  for (int i = 0; i < result->rows; i++) {
+    memset(result->matrix[i], 0, result->columns * sizeof(double));
+    if (i < A->rows) {
+      memcpy(result->matrix[i], A->matrix[i], A->columns * sizeof(double));
+    }
+  }
+}
+
+int s21_strassen(int levels, double alpha, matrix_t *A, matrix_t *B,
+                 matrix_t *C) {
+  int m = s21_padded(A->rows, levels);
+  int k = s21_padded(A->columns, levels);
+  int n = s21_padded(B->columns, levels);
+  s21_scratch_t scratch;
+  size_t bytes =
+      s21_strassen_workspace(A->rows, A->columns, B->columns, levels);
+  int err_code = s21_scratch_open(&scratch, bytes);
+  if (err_code == OK && (m != A->rows || k != A->columns || n != B->columns)) {
+    matrix_t Ap = {0};
+    matrix_t Bp = {0};
+    matrix_t Cp = {0};
+    s21_create_matrix_arena(m, k, scratch.arena, &Ap);
+    s21_create_matrix_arena(k, n, scratch.arena, &Bp);
+    s21_create_matrix_arena(m, n, scratch.arena, &Cp);
+    s21_pad_copy(A, &Ap);
+    s21_pad_copy(B, &Bp);
+    s21_winograd(m, k, n, alpha, Ap.matrix, 0, Bp.matrix, 0, Cp.matrix, 0,
+                 levels, scratch.arena);
+    for (int i = 0; i < C->rows; i++) {
+      memcpy(C->matrix[i], Cp.matrix[i], C->columns * sizeof(double));
+    }
+  } else if (err_code == OK) {
+    s21_winograd(m, k, n, alpha, A->matrix, 0, B->matrix, 0, C->matrix, 0,
+                 levels, scratch.arena);
+  }
+  s21_scratch_close(&scratch);
+  return err_code;
+}
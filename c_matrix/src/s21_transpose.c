@@ -0,0 +1,208 @@
+#include <string.h>
+
+#include "s21_internal.h"
+
+static void s21_transpose_leaf(double *const *src, int sc, int rows, int cols,
+                               double **dst, int dc,
+                               const s21_kernels_t *kernels) {
+  int block = kernels->transpose_block;
+  int full_r = rows / block * block;
+  int full_c = cols / block * block;
+  for (int i = 0; i < full_r; i += block) {
+    for (int j = 0; j < full_c; j += block) {
+      kernels->transpose(src + i, sc + j, dst + j, dc + i);
+    }
+  }
+  for (int i = 0; i < rows; i++) {
+    int j = i < full_r ? full_c : 0;
+    for (; j < cols; j++) dst[j][dc + i] = src[i][sc + j];
+  }
+}
+
+static void s21_transpose_rec(double *const *src, int sc, int rows, int cols,
+                              double **dst, int dc,
+                              const s21_kernels_t *kernels) {
+  if (rows <= S21_TRANSPOSE_LEAF && cols <= S21_TRANSPOSE_LEAF) {
+    s21_transpose_leaf(src, sc, rows, cols, dst, dc, kernels);
+  } else if (rows >= cols) {
+    int half = rows / 2 / S21_TRANSPOSE_LEAF * S21_TRANSPOSE_LEAF;
+    if (half == 0) half = rows / 2;
+    s21_transpose_rec(src, sc, half, cols, dst, dc, kernels);
+    s21_transpose_rec(src + half, sc, rows - half, cols, dst, dc + half,
+                      kernels);
+  } else {
+    int half = cols / 2 / S21_TRANSPOSE_LEAF * S21_TRANSPOSE_LEAF;
+    if (half == 0) half = cols / 2;
+    s21_transpose_rec(src, sc, rows, half, dst, dc, kernels);
+    s21_transpose_rec(src, sc + half, rows, cols - half, dst + half, dc,
+                      kernels);
+  }
+}
+
+void s21_fill_transpose(matrix_t *A, matrix_t *result) {
+  s21_transpose_rec(A->matrix, 0, A->rows, A->columns, result->matrix, 0,
+                    s21_kernels());
+}
+
+void s21_transpose_square(matrix_t *A) {
+  const s21_kernels_t *kernels = s21_kernels();
+  double tile[S21_TRANSPOSE_LEAF][S21_TRANSPOSE_LEAF];
+  double *tile_rows[S21_TRANSPOSE_LEAF];
+  for (int i = 0; i < S21_TRANSPOSE_LEAF; i++) tile_rows[i] = tile[i];
+  int n = A->rows;
+  double **a = A->matrix;
+  for (int i0 = 0; i0 < n; i0 += S21_TRANSPOSE_LEAF) {
+    int bi = n - i0 < S21_TRANSPOSE_LEAF ? n - i0 : S21_TRANSPOSE_LEAF;
+    for (int i = i0; i < i0 + bi; i++) {
+      for (int j = i + 1; j < i0 + bi; j++) {
+        double tmp = a[i][j];
+        a[i][j] = a[j][i];
+        a[j][i] = tmp;
+      }
+    }
+    for (int j0 = i0 + bi; j0 < n; j0 += S21_TRANSPOSE_LEAF) {
+      int bj = n - j0 < S21_TRANSPOSE_LEAF ? n - j0 : S21_TRANSPOSE_LEAF;
+      s21_transpose_leaf(a + i0, j0, bi, bj, tile_rows, 0, kernels);
+      s21_transpose_leaf(a + j0, i0, bj, bi, a + i0, j0, kernels);
+      for (int j = 0; j < bj; j++) {
+        memcpy(a[j0 + j] + i0, tile[j], bi * sizeof(double));
+      }
+    }
+  }
+}
+
+void s21_storage(matrix_t *A, matrix_t *result) {
+  *result = *A;
+  if (s21_is_lazy(A)) {
+    result->rows = A->columns;
+    result->columns = A->rows;
+  }
+  result->flags = S21_BORROWED;
+}
+
+size_t s21_orient_bytes(matrix_t *A, int lazy) {
+  size_t bytes = 0;
+  if (s21_is_lazy(A) != lazy) {
+    bytes = lazy ? s21_matrix_bytes(A->columns, A->rows)
+                 : s21_matrix_bytes(A->rows, A->columns);
+  }
+  return bytes;
+}
+
+void s21_orient(matrix_t *A, int lazy, arena_t *arena, matrix_t *result) {
+  matrix_t storage;
+  s21_storage(A, &storage);
+  if (s21_is_lazy(A) == lazy) {
+    *result = storage;
+  } else {
+    s21_create_matrix_arena(storage.columns, storage.rows, arena, result);
+    s21_fill_transpose(&storage, result);
+  }
+}
+
+static int s21_is_packed_block(matrix_t *A) {
+  int packed = A->data != NULL &&
+               !(A->flags & (S21_BORROWED | S21_MAPPED | S21_VIEW));
+  for (int i = 0; i < A->rows && packed; i++) {
+    packed = A->matrix[i] == A->data + (size_t)i * A->stride;
+  }
+  return packed;
+}
+
+static void s21_cycle_transpose(double *data, int rows, int cols,
+                                unsigned char *done) {
+  size_t last = (size_t)rows * cols - 1;
+  for (size_t start = 1; start < last; start++) {
+    if (done[start / 8] & (1u << (start % 8))) continue;
+    size_t k = start;
+    double carried = data[start];
+    do {
+      size_t next = k * rows % last;
+      double tmp = data[next];
+      data[next] = carried;
+      carried = tmp;
+      done[k / 8] |= (unsigned char)(1u << (k % 8));
+      k = next;
+    } while (k != start);
+  }
+}
+
+int s21_transpose_inplace(matrix_t *A) {
+  int err_code = OK;
+  if (!s21_is_matrix_ok(A) || !s21_is_writable(A)) {
+    err_code = INCORRECT_MATRIX;
+  } else if (s21_is_lazy(A)) {
+    int rows = A->rows;
+    A->rows = A->columns;
+    A->columns = rows;
+    A->flags &= ~S21_TRANSPOSED;
+  } else if (A->rows == A->columns) {
+    s21_transpose_square(A);
+  } else if (!s21_is_packed_block(A)) {
+    err_code = INCORRECT_MATRIX;
+  } else {
+    int rows = A->rows;
+    int cols = A->columns;
+    int stride = s21_row_stride(rows);
+    size_t count = (size_t)rows * cols;
+    unsigned char *done = (unsigned char *)calloc(count / 8 + 1, 1);
+    double **row_ptrs = (double **)malloc(cols * sizeof(double *));
+    double *data = A->data;
+    if ((size_t)cols * stride > (size_t)rows * A->stride) {
+      data = s21_alloc_block((size_t)cols * stride);
+    }
+    if (done != NULL && row_ptrs != NULL && data != NULL) {
+      for (int i = 1; i < rows; i++) {
+        memmove(A->data + (size_t)i * cols, A->matrix[i],
+                cols * sizeof(double));
+      }
+      s21_cycle_transpose(A->data, rows, cols, done);
+      for (int i = cols - 1; i >= 0; i--) {
+        row_ptrs[i] = data + (size_t)i * stride;
+        memmove(row_ptrs[i], A->data + (size_t)i * rows, rows * sizeof(double));
+        memset(row_ptrs[i] + rows, 0, (stride - rows) * sizeof(double));
+      }
+      if (data != A->data) free(A->data);
+      free(A->matrix);
+      A->matrix = row_ptrs;
+      A->data = data;
+      A->rows = cols;
+      A->columns = rows;
+      A->stride = stride;
+      row_ptrs = NULL;
+    } else {
+      if (data != A->data) free(data);
+      err_code = INCORRECT_MATRIX;
+    }
+    free(done);
+    free(row_ptrs);
+  }
+  return err_code;
+}
+
+int s21_transpose_lazy(matrix_t *A, matrix_t *result) {
+  if (!s21_is_matrix_ok(A) || result == NULL) return INCORRECT_MATRIX;
+  s21_storage(A, result);
+  result->rows = A->columns;
+  result->columns = A->rows;
+  result->flags = s21_is_lazy(A) ? S21_BORROWED : S21_BORROWED | S21_TRANSPOSED;
+  result->flags |= A->flags & S21_READONLY;
+  return OK;
+}
+
+void s21_copy_logical(matrix_t *A, matrix_t *result) {
+  matrix_t storage;
+  s21_storage(A, &storage);
+  if (s21_is_lazy(A)) {
+    s21_fill_transpose(&storage, result);
+  } else {
+    s21_copy_matrix(&storage, result);
+  }
+}
+
+int s21_materialize(matrix_t *A, matrix_t *result) {
+  if (!s21_is_matrix_ok(A)) return INCORRECT_MATRIX;
+  int err_code = s21_create_matrix(A->rows, A->columns, result);
+  if (err_code == OK) s21_copy_logical(A, result);
+  return err_code;
+}
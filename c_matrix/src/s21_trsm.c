@@ -0,0 +1,49 @@
+#include "s21_internal.h"
+
+static double s21_trsm_at(double *const *t, int jt, int trans, int i, int p) {
+  return trans ? t[p][jt + i] : t[i][jt + p];
+}
+
+static void s21_trsm_block(int forward, int trans, int unit, int i0, int i1,
+                           double *const *t, int jt, int nrhs, double **b,
+                           int jb) {
+  for (int s = 0; s < i1 - i0; s++) {
+    int i = forward ? i0 + s : i1 - 1 - s;
+    int lo = forward ? i0 : i + 1;
+    int hi = forward ? i : i1;
+    double *dst = b[i] + jb;
+    for (int p = lo; p < hi; p++) {
+      double l = s21_trsm_at(t, jt, trans, i, p);
+      if (l != 0) {
+        const double *src = b[p] + jb;
+        for (int j = 0; j < nrhs; j++) dst[j] -= l * src[j];
+      }
+    }
+    if (!unit) {
+      double inv = 1.0 / s21_trsm_at(t, jt, trans, i, i);
+      for (int j = 0; j < nrhs; j++) dst[j] *= inv;
+    }
+  }
+}
+
+void s21_trsm(int uplo, int trans, int unit, int n, double *const *t, int jt,
+              int nrhs, double **b, int jb) {
+  int forward = (uplo == S21_LOWER) != (trans == S21_TRANS);
+  int blocks = (n + S21_LU_BLOCK - 1) / S21_LU_BLOCK;
+  for (int s = 0; s < blocks; s++) {
+    int i0 = (forward ? s : blocks - 1 - s) * S21_LU_BLOCK;
+    int i1 = n - i0 < S21_LU_BLOCK ? n : i0 + S21_LU_BLOCK;
+    if (forward && i0 > 0) {
+      double *const *a = trans ? t : t + i0;
+      int ja = trans ? jt + i0 : jt;
+      s21_dgemm(trans, S21_NO_TRANS, i1 - i0, nrhs, i0, -1.0, a, ja, b, jb,
+                1.0, b + i0, jb);
+    } else if (!forward && i1 < n) {
+      double *const *a = trans ? t + i1 : t + i0;
+      int ja = trans ? jt + i0 : jt + i1;
+      s21_dgemm(trans, S21_NO_TRANS, i1 - i0, nrhs, n - i1, -1.0, a, ja,
+                b + i1, jb, 1.0, b + i0, jb);
+    }
+    s21_trsm_block(forward, trans, unit, i0, i1, t, jt, nrhs, b, jb);
+  }
+}
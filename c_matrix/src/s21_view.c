@@ -0,0 +1,68 @@
+#include "s21_internal.h"
+
+void s21_minor_rows(matrix_t *A, int row, int column, double **rows) {
+  for (int i = 0, r = 0; i < A->rows; i++) {
+    if (i != row) rows[r++] = A->matrix[i] + column;
+  }
+}
+
+static int s21_view_rows(int rows, int columns, matrix_t *result) {
+  result->matrix = (double **)malloc(rows * sizeof(double *));
+  result->data = NULL;
+  result->rows = rows;
+  result->columns = columns;
+  result->stride = 0;
+  result->flags = S21_VIEW;
+  return result->matrix ? OK : INCORRECT_MATRIX;
+}
+
+static void s21_lazy_view(matrix_t *result) {
+  int rows = result->rows;
+  result->rows = result->columns;
+  result->columns = rows;
+  result->flags |= S21_TRANSPOSED;
+}
+
+int s21_create_view(matrix_t *A, int row, int column, int rows, int columns,
+                    matrix_t *result) {
+  if (!s21_is_matrix_ok(A) || result == NULL) return INCORRECT_MATRIX;
+  int err_code = CALCULATION_ERROR;
+  if (s21_is_lazy(A)) {
+    matrix_t storage;
+    s21_storage(A, &storage);
+    err_code = s21_create_view(&storage, column, row, columns, rows, result);
+    if (err_code == OK) s21_lazy_view(result);
+  } else if (row >= 0 && column >= 0 && rows > 0 && columns > 0 &&
+      rows <= A->rows - row && columns <= A->columns - column) {
+    err_code = s21_view_rows(rows, columns, result);
+    for (int i = 0; i < rows && err_code == OK; i++) {
+      result->matrix[i] = A->matrix[row + i] + column;
+    }
+  }
+  if (err_code == OK) result->flags |= A->flags & S21_READONLY;
+  return err_code;
+}
+
+int s21_create_minor_view(matrix_t *A, int row, int column,
+                          matrix_t *result) {
+  if (!s21_is_matrix_ok(A) || result == NULL) return INCORRECT_MATRIX;
+  int err_code = CALCULATION_ERROR;
+  if (s21_is_lazy(A)) {
+    matrix_t storage;
+    s21_storage(A, &storage);
+    err_code = s21_create_minor_view(&storage, column, row, result);
+    if (err_code == OK) s21_lazy_view(result);
+  } else if (A->rows > 1 && A->columns > 1 && row >= 0 && row < A->rows &&
+             (column == 0 || column == A->columns - 1)) {
+    err_code = s21_view_rows(A->rows - 1, A->columns - 1, result);
+    if (err_code == OK) {
+      s21_minor_rows(A, row, column == 0 ? 1 : 0, result->matrix);
+    }
+  } else if (A->rows > 1 && A->columns > 1 && row >= 0 && row < A->rows &&
+             column > 0 && column < A->columns - 1) {
+    err_code = s21_create_matrix(A->rows - 1, A->columns - 1, result);
+    if (err_code == OK) s21_fill_matrix(row, column, A, result);
+  }
+  if (err_code == OK) result->flags |= A->flags & S21_READONLY;
+  return err_code;
+}